@@ -0,0 +1,498 @@
+//
+//  Core6502Bench.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <sstream>
+#include <benchmark/benchmark.h>
+#include "Core6502.hpp"
+#include "Core6502Batch.hpp"
+#include "Core6502Fleet.hpp"
+#include "Core6502Snapshot.hpp"
+#include "Core6502SaveState.hpp"
+#include "Core6502Trace.hpp"
+#include "Core6502Debugger.hpp"
+
+// Every program is loaded at 0x8000 and runs until PC reaches its end address.  Instruction
+// and cycle counts for one pass are measured once by stepping the table core, then each
+// benchmark iteration is one runUntil() pass on the core under test.
+
+struct Program {
+	const char * name;
+	std::vector<uint8_t> code;
+	uint16_t end;						// Address the pass stops at
+	void (*setup)(uint8_t * mem);		// Data the program expects, may be NULL
+};
+
+struct Core {
+	const char * name;
+	Core6502::Interpreter interpreter;
+};
+
+static const Core cores[] = {
+	{"table", Core6502::Interpreter::Table},
+	{"switch", Core6502::Interpreter::Switch},
+	{"cached", Core6502::Interpreter::Cached},
+#ifdef CORE6502_JIT
+	{"jit", Core6502::Interpreter::JIT},
+#endif
+};
+
+// Opcode family program: prefix, then copies of pattern, then a NOP the pass ends on
+static Program repeat(const char * name, std::vector<uint8_t> prefix, std::vector<uint8_t> pattern,
+	int copies, void (*setup)(uint8_t *) = NULL) {
+
+	Program program = {name, prefix, 0, setup};
+
+	for (int i = 0; i < copies; i++)
+		program.code.insert(program.code.end(), pattern.begin(), pattern.end());
+
+	program.end = 0x8000 + program.code.size();
+	program.code.push_back(0xEA);
+
+	return program;
+
+}
+
+static void setupData(uint8_t * mem) {
+
+	// Nonzero data, plus a pointer at $30 for indirect indexed loads
+	for (int i = 0; i < 0x100; i++) {
+		mem[0x0000 + i] = (uint8_t)(i * 7 + 1);
+		mem[0x0300 + i] = (uint8_t)(i * 13 + 5);
+		mem[0x2000 + i] = (uint8_t)i;
+	}
+
+	mem[0x30] = 0x00;
+	mem[0x31] = 0x03;
+
+}
+
+static void setupSubroutine(uint8_t * mem) {
+
+	// RTS at 0x9000.  RTS pops the high byte from the slot below the return address (see
+	// Core6502Tests_Jump), so the program's page is left there for it and every call has
+	// to return into page 0x80.
+	mem[0x9000] = 0x60;
+	mem[0x01FD] = 0x80;
+
+}
+
+static void setupMultiply(uint8_t * mem) {
+
+	// Second factor
+	mem[0x11] = 0xA7;
+
+}
+
+static std::vector<Program> programs() {
+
+	std::vector<Program> list;
+
+	// Opcode families, 512 instructions each except JSR/RTS
+	list.push_back(repeat("nop", {}, {0xEA}, 512));
+	list.push_back(repeat("loads", {0xA2, 0x04, 0xA0, 0x02}, {
+		0xA9, 0x12,				// LDA #$12
+		0xA6, 0x20,				// LDX $20
+		0xAC, 0x00, 0x03,		// LDY $0300
+		0xBD, 0x00, 0x03,		// LDA $0300,X
+		0xB1, 0x30,				// LDA ($30),Y
+		0xB5, 0x40,				// LDA $40,X
+		0xB9, 0x10, 0x03,		// LDA $0310,Y
+		0xA5, 0x21,				// LDA $21
+	}, 64, setupData));
+	list.push_back(repeat("alu", {0xA2, 0x04}, {
+		0x69, 0x01,				// ADC #$01
+		0x29, 0xFE,				// AND #$FE
+		0x05, 0x20,				// ORA $20
+		0x4D, 0x00, 0x03,		// EOR $0300
+		0xC9, 0x10,				// CMP #$10
+		0xE9, 0x01,				// SBC #$01
+		0x75, 0x40,				// ADC $40,X
+		0xE0, 0x08,				// CPX #$08
+	}, 64, setupData));
+	list.push_back(repeat("rmw", {0xA2, 0x04}, {
+		0x06, 0x20,				// ASL $20
+		0x2A,					// ROL A
+		0x4E, 0x00, 0x03,		// LSR $0300
+		0x76, 0x40,				// ROR $40,X
+		0xE6, 0x21,				// INC $21
+		0xCE, 0x01, 0x03,		// DEC $0301
+		0x4A,					// LSR A
+		0x3E, 0x10, 0x03,		// ROL $0310,X
+	}, 64, setupData));
+	list.push_back(repeat("branch_taken", {0xA2, 0x01}, {
+		0xD0, 0x00,				// BNE to the next instruction
+	}, 512));
+	list.push_back(repeat("branch_not_taken", {0xA2, 0x01}, {
+		0xF0, 0x00,				// BEQ, never taken
+	}, 512));
+	list.push_back(repeat("jsr_rts", {}, {
+		0x20, 0x00, 0x90,		// JSR $9000, which returns straight away
+	}, 80, setupSubroutine));
+
+	// Whole programs
+	list.push_back({"n_sum", {
+		0xA9, 0x00,				// LDA #$00
+		0xA2, 0xFF,				// LDX #$FF
+		0x86, 0x40,				// STX $40
+		0x65, 0x40,				// ADC $40
+		0xCA,					// DEX
+		0xD0, 0x04,				// BNE $800F
+		0xEA,					// NOP
+		0x4C, 0x0B, 0x80,		// JMP $800B
+		0x4C, 0x04, 0x80		// JMP $8004
+	}, 0x800B, NULL});
+	list.push_back({"memcpy", {
+		0xA0, 0x00,				// LDY #$00
+		0xB9, 0x00, 0x20,		// LDA $2000,Y
+		0x99, 0x00, 0x30,		// STA $3000,Y
+		0xC8,					// INY
+		0xD0, 0xF7,				// BNE $8002
+		0xEA					// NOP
+	}, 0x800B, setupData});
+	list.push_back({"multiply", {
+		0xA0, 0x10,				// LDY #$10			16 products of Y * $11
+		0x98,					// TYA
+		0x85, 0x10,				// STA $10
+		0xA9, 0x00,				// LDA #$00
+		0xA2, 0x08,				// LDX #$08
+		0x46, 0x10,				// LSR $10
+		0x90, 0x03,				// BCC $8010
+		0x18,					// CLC
+		0x65, 0x11,				// ADC $11
+		0x6A,					// ROR A
+		0x66, 0x10,				// ROR $10			Low byte of the product
+		0xCA,					// DEX
+		0xD0, 0xF5,				// BNE $800B
+		0x85, 0x12,				// STA $12			High byte of the product
+		0x88,					// DEY
+		0xD0, 0xE7,				// BNE $8002
+		0xEA					// NOP
+	}, 0x801B, setupMultiply});
+
+	return list;
+
+}
+
+// Memory for one CPU with program and data loaded and the reset vector pointing at it
+static void load(const Program & program, std::vector<uint8_t> & mem) {
+
+	mem.assign(0x10000, 0);
+	memcpy(&mem[0x8000], &program.code[0], program.code.size());
+	if (program.setup) program.setup(&mem[0]);
+
+	mem[0xFFFC] = 0x00;
+	mem[0xFFFD] = 0x80;
+
+}
+
+// Instructions and cycles of one pass, stepped on the table core
+static void measurePass(const Program & program, uint64_t & instructions, uint64_t & cycles) {
+
+	std::vector<uint8_t> mem;
+	load(program, mem);
+
+	Core6502::CPU cpu(&mem[0], Core6502::Interpreter::Table);
+	cpu.reset();
+
+	instructions = 0;
+	cycles = 0;
+
+	while (cpu.registers.PC != program.end) {
+		cycles += cpu.step();
+		instructions++;
+	}
+
+}
+
+// With traced set, a trace is attached for the whole run (only built with CORE6502_TRACE)
+static void benchProgram(benchmark::State & state, Program program, Core6502::Interpreter interpreter, bool traced) {
+
+	uint64_t instructions, cycles;
+	measurePass(program, instructions, cycles);
+
+	std::vector<uint8_t> mem;
+	load(program, mem);
+
+	Core6502::CPU * cpu = new Core6502::CPU(&mem[0], interpreter);
+	cpu->reset();
+
+	Core6502::Trace trace(4095);
+	if (traced) cpu->trace = &trace;
+
+	for (auto _ : state) {
+		cpu->registers.PC = 0x8000;
+		benchmark::DoNotOptimize(cpu->runUntil(program.end, 0xFFFFFFFF));
+	}
+
+	state.SetItemsProcessed(state.iterations() * instructions);
+
+	// Emulated clock as cycles per second, and host time per emulated instruction
+	state.counters["cycles"] = benchmark::Counter(cycles, benchmark::Counter::kIsIterationInvariantRate);
+	state.counters["per_instr"] = benchmark::Counter(instructions,
+		benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+
+	delete cpu;
+
+}
+
+// One group of Batch::Width CPUs running the same pass through a Batch.  Items are lane
+// instructions, so items_per_second compares directly with a single CPU on the other cores.
+static void benchBatch(benchmark::State & state, Program program) {
+
+	uint64_t instructions, cycles;
+	measurePass(program, instructions, cycles);
+
+	const int lanes = Core6502::Batch::Width;
+	std::vector<uint8_t> mem[lanes];
+	Core6502::CPU * cpus[lanes];
+	Core6502::Batch batch;
+
+	for (int i = 0; i < lanes; i++) {
+		load(program, mem[i]);
+		cpus[i] = new Core6502::CPU(&mem[i][0], Core6502::Interpreter::Switch);
+		cpus[i]->reset();
+		batch.add(*cpus[i]);
+	}
+
+	for (auto _ : state) {
+		for (int i = 0; i < lanes; i++) cpus[i]->registers.PC = 0x8000;
+		benchmark::DoNotOptimize(batch.run(cycles));
+	}
+
+	state.SetItemsProcessed(state.iterations() * instructions * lanes);
+
+	state.counters["cycles"] = benchmark::Counter(cycles * lanes, benchmark::Counter::kIsIterationInvariantRate);
+	state.counters["per_instr"] = benchmark::Counter(instructions * lanes,
+		benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+	state.counters["lockstep"] = (double)batch.lockstepInstructions /
+		(batch.lockstepInstructions + batch.scalarInstructions);
+
+	for (int i = 0; i < lanes; i++) delete cpus[i];
+
+}
+
+// 256 CPUs looping over n_sum on a Fleet with state.range(0) threads.  efficiency is wall
+// clock throughput per thread relative to the single thread run, which is registered first.
+static void benchFleet(benchmark::State & state, Program program) {
+
+	const int instances = 256;
+	const uint64_t cycles = 200000;
+	static double baseline = 0;
+
+	// JMP back to the start in place of the NOP the pass ends on
+	size_t end = program.end - 0x8000;
+	program.code[end] = 0x4C;
+	program.code[end + 1] = 0x00;
+	program.code[end + 2] = 0x80;
+
+	std::vector<uint8_t> mem[instances];
+	Core6502::CPU * cpus[instances];
+
+	for (int i = 0; i < instances; i++) {
+		load(program, mem[i]);
+		cpus[i] = new Core6502::CPU(&mem[i][0], Core6502::Interpreter::Switch);
+		cpus[i]->reset();
+	}
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	for (auto _ : state) {
+		Core6502::Fleet fleet;
+		for (int i = 0; i < instances; i++) fleet.add(*cpus[i], cycles);
+		fleet.run((unsigned)state.range(0));
+	}
+
+	std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+	double rate = state.iterations() * instances * cycles / seconds.count();
+
+	state.counters["cycles"] = benchmark::Counter(instances * cycles, benchmark::Counter::kIsIterationInvariantRate);
+
+	if (state.range(0) == 1) baseline = rate;
+	if (baseline > 0) state.counters["efficiency"] = rate / (baseline * state.range(0));
+
+	for (int i = 0; i < instances; i++) delete cpus[i];
+
+}
+
+// Latency of a snapshot plus a restore with state.range(0) pages written in between
+static void benchSnapshot(benchmark::State & state) {
+
+	std::vector<uint8_t> mem(0x10000, 0);
+	Core6502::CPU * cpu = new Core6502::CPU(&mem[0], Core6502::Interpreter::Switch);
+	Core6502::Snapshots snapshots(*cpu);
+	Core6502::Snapshot * base = snapshots.take();
+
+	int pages = (int)state.range(0);
+	uint8_t value = 0;
+
+	for (auto _ : state) {
+		value++;
+		for (int i = 0; i < pages; i++) cpu->write(i << 8, value);
+
+		Core6502::Snapshot * snapshot = snapshots.take();
+		snapshots.restore(*base);
+		delete snapshot;
+	}
+
+	delete base;
+	delete cpu;
+
+}
+
+// Baseline for benchSnapshot: copying all of memory and the registers out and back
+static void benchSnapshotCopy(benchmark::State & state) {
+
+	std::vector<uint8_t> mem(0x10000, 0);
+	std::vector<uint8_t> saved(0x10000, 0);
+	Core6502::CPU * cpu = new Core6502::CPU(&mem[0], Core6502::Interpreter::Switch);
+	uint8_t value = 0;
+
+	for (auto _ : state) {
+		cpu->write(0, ++value);
+
+		std::vector<uint8_t> copy = mem;
+		uint8_t registers[sizeof(cpu->registers)];
+		memcpy(registers, &cpu->registers, sizeof(registers));
+		benchmark::DoNotOptimize(&copy[0]);
+
+		memcpy(&mem[0], &saved[0], mem.size());
+		memcpy(&cpu->registers, registers, sizeof(registers));
+		benchmark::ClobberMemory();
+	}
+
+	delete cpu;
+
+}
+
+// A pass with a debugger attached: nothing armed when state.range(0) is 0, which should match
+// the plain <program>/<core> run, or a breakpoint and a watchpoint on pages the program never
+// touches when it's 1
+static void benchDebugger(benchmark::State & state, Program program, Core6502::Interpreter interpreter) {
+
+	uint64_t instructions, cycles;
+	measurePass(program, instructions, cycles);
+
+	std::vector<uint8_t> mem;
+	load(program, mem);
+
+	Core6502::CPU * cpu = new Core6502::CPU(&mem[0], interpreter);
+	cpu->reset();
+
+	Core6502::Debugger * debugger = new Core6502::Debugger(*cpu);
+	cpu->debugger = debugger;
+	if (state.range(0)) {
+		debugger->addBreakpoint(0xF000);
+		debugger->addWatchpoint(0xF100, Core6502::Debugger::Read | Core6502::Debugger::Write);
+	}
+
+	for (auto _ : state) {
+		cpu->registers.PC = 0x8000;
+		benchmark::DoNotOptimize(cpu->runUntil(program.end, 0xFFFFFFFF));
+	}
+
+	state.SetItemsProcessed(state.iterations() * instructions);
+	state.counters["per_instr"] = benchmark::Counter(instructions,
+		benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+
+	delete debugger;
+	delete cpu;
+
+}
+
+// Writing then reading one save state of a CPU that ran memcpy, against a base image of its
+// memory before the run when state.range(0) is set
+static void benchSaveState(benchmark::State & state, Program program) {
+
+	std::vector<uint8_t> mem, loadedMem(0x10000, 0);
+	load(program, mem);
+	std::vector<uint8_t> base = mem;
+
+	Core6502::CPU * cpu = new Core6502::CPU(&mem[0], Core6502::Interpreter::Switch);
+	Core6502::CPU * loaded = new Core6502::CPU(&loadedMem[0], Core6502::Interpreter::Switch);
+	cpu->reset();
+	cpu->runUntil(program.end, 0xFFFFFFFF);
+
+	const uint8_t * against = state.range(0) ? &base[0] : NULL;
+	std::stringstream stream;
+	size_t bytes = 0;
+
+	for (auto _ : state) {
+		stream.seekp(0);
+		stream.seekg(0);
+		Core6502::SaveState::write(stream, *cpu, against);
+		bytes = stream.tellp();
+		benchmark::DoNotOptimize(Core6502::SaveState::read(stream, *loaded, against));
+	}
+
+	state.SetItemsProcessed(state.iterations());
+	state.counters["bytes"] = bytes;
+
+	delete cpu;
+	delete loaded;
+
+}
+
+// Registers every program on every core as <program>/<core>, e.g. n_sum/switch, plus
+// <program>/batch, n_sum/<core>/debugger:<armed>, fleet/threads:<n> from 1 to the hardware
+// thread count, and the snapshot and save state latencies.
+// Usage: Core6502Bench [--benchmark_filter=<regex>] ...
+int main(int argc, char ** argv) {
+
+	std::vector<Program> list = programs();
+
+	for (size_t i = 0; i < list.size(); i++) {
+		for (size_t j = 0; j < sizeof(cores) / sizeof(cores[0]); j++) {
+			std::string name = std::string(list[i].name) + "/" + cores[j].name;
+			benchmark::RegisterBenchmark(name.c_str(), benchProgram, list[i], cores[j].interpreter, false);
+#ifdef CORE6502_TRACE
+			name += "/traced";
+			benchmark::RegisterBenchmark(name.c_str(), benchProgram, list[i], cores[j].interpreter, true);
+#endif
+		}
+
+		std::string name = std::string(list[i].name) + "/batch";
+		benchmark::RegisterBenchmark(name.c_str(), benchBatch, list[i]);
+	}
+
+	for (size_t i = 0; i < list.size(); i++) {
+		if (strcmp(list[i].name, "n_sum") != 0) continue;
+
+		for (size_t j = 0; j < sizeof(cores) / sizeof(cores[0]); j++) {
+			std::string name = std::string(list[i].name) + "/" + cores[j].name + "/debugger";
+			benchmark::RegisterBenchmark(name.c_str(), benchDebugger, list[i], cores[j].interpreter)->ArgName("armed")->Arg(0)->Arg(1);
+		}
+
+		unsigned hardware = std::thread::hardware_concurrency();
+		benchmark::internal::Benchmark * fleet = benchmark::RegisterBenchmark("fleet", benchFleet, list[i]);
+		fleet->ArgName("threads")->UseRealTime()->Unit(benchmark::kMillisecond);
+		for (unsigned threads = 1; threads < hardware; threads *= 2) fleet->Arg(threads);
+		fleet->Arg(hardware > 1 ? hardware : 1);
+	}
+
+	benchmark::RegisterBenchmark("snapshot", benchSnapshot)->ArgName("dirty")->Arg(1)->Arg(4)->Arg(16)->Arg(64)->Arg(256);
+	benchmark::RegisterBenchmark("snapshot/full_copy", benchSnapshotCopy);
+
+	for (size_t i = 0; i < list.size(); i++) {
+		if (strcmp(list[i].name, "memcpy") != 0) continue;
+		benchmark::RegisterBenchmark("save_state", benchSaveState, list[i])->ArgName("delta")->Arg(0)->Arg(1);
+	}
+
+	benchmark::Initialize(&argc, argv);
+	if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+
+	return 0;
+
+}
@@ -0,0 +1,124 @@
+//
+//  Core6502NSumBench.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <chrono>
+#include "Core6502.hpp"
+
+// Same program as examples/n_sum with N = 255
+static const uint8_t program[] = {
+	0xA9, 0x00,			// LDA #$00
+	0xA2, 0xFF,			// LDX #$FF
+	0x86, 0x40,			// STX $40
+	0x65, 0x40,			// ADC $40
+	0xCA,				// DEX
+	0xD0, 0x04,			// BNE $800F
+	0xEA,				// NOP
+	0x4C, 0x0B, 0x80,	// JMP $800B
+	0x4C, 0x04, 0x80	// JMP $8004
+};
+
+static uint8_t mem[0x10000];
+
+static void loadProgram(Core6502::CPU & cpu) {
+
+	// Set reset vector and reset CPU
+	mem[0xFFFC] = 0x00;
+	mem[0xFFFD] = 0x80;
+
+	for (size_t i = 0; i < sizeof(program); i++)
+		mem[0x8000 + i] = program[i];
+
+	cpu.reset();
+
+}
+
+// Clocks the CPU once per cycle, restarting the sum once the program reaches its spin loop
+static double benchClock(uint64_t instructions, uint64_t & cycles) {
+
+	Core6502::CPU cpu(mem);
+	loadProgram(cpu);
+
+	uint64_t executed = 0;
+	cycles = 0;
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	while (executed < instructions) {
+
+		if (!cpu.cyclesRemaining) {
+			if (cpu.registers.PC == 0x800B) cpu.registers.PC = 0x8000;
+			executed++;
+		}
+
+		cpu.clock();
+		cycles++;
+
+	}
+
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	return elapsed.count();
+
+}
+
+// Runs the same number of cycles through the batched run loop
+static double benchRun(Core6502::Interpreter interpreter, uint64_t cycles) {
+
+	Core6502::CPU cpu(mem, interpreter);
+	loadProgram(cpu);
+
+	uint64_t ran = 0;
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	while (ran < cycles) {
+		ran += cpu.runUntil(0x800B, 1000000);
+		if (cpu.registers.PC == 0x800B) cpu.registers.PC = 0x8000;
+	}
+
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	return elapsed.count();
+
+}
+
+// Runs the n_sum example program in a loop and reports emulated instructions per second.
+// Usage: Core6502NSumBench [instructions]
+int main(int argc, char ** argv) {
+
+	uint64_t instructions = (argc > 1) ? strtoull(argv[1], NULL, 10) : 50000000ULL;
+	uint64_t cycles;
+
+	double clockTime = benchClock(instructions, cycles);
+	double tableTime = benchRun(Core6502::Interpreter::Table, cycles);
+	double switchTime = benchRun(Core6502::Interpreter::Switch, cycles);
+	double cachedTime = benchRun(Core6502::Interpreter::Cached, cycles);
+
+	printf("n_sum: %llu instructions, %llu cycles\n",
+		(unsigned long long)instructions, (unsigned long long)cycles);
+	printf("  clock():             %7.2f M instructions/s, %7.2f emulated MHz\n",
+		instructions / clockTime / 1e6, cycles / clockTime / 1e6);
+	printf("  runUntil() (table):  %7.2f M instructions/s, %7.2f emulated MHz\n",
+		instructions / tableTime / 1e6, cycles / tableTime / 1e6);
+	printf("  runUntil() (switch): %7.2f M instructions/s, %7.2f emulated MHz\n",
+		instructions / switchTime / 1e6, cycles / switchTime / 1e6);
+	printf("  runUntil() (cached): %7.2f M instructions/s, %7.2f emulated MHz\n",
+		instructions / cachedTime / 1e6, cycles / cachedTime / 1e6);
+
+#ifdef CORE6502_JIT
+	double jitTime = benchRun(Core6502::Interpreter::JIT, cycles);
+
+	printf("  runUntil() (jit):    %7.2f M instructions/s, %7.2f emulated MHz\n",
+		instructions / jitTime / 1e6, cycles / jitTime / 1e6);
+	printf("  jit speedup: %.2fx over switch, %.2fx over cached\n",
+		switchTime / jitTime, cachedTime / jitTime);
+#endif
+
+	return 0;
+
+}
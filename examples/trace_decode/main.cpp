@@ -0,0 +1,33 @@
+#include <stdio.h>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include "Core6502Trace.hpp"
+
+// Prints a dump written by Core6502::Trace::write() as one line per instruction
+int main(int argc, char ** argv) {
+
+	if (argc != 2) {
+		fprintf(stderr, "usage: %s <trace file>\n", argv[0]);
+		return 1;
+	}
+
+	std::ifstream in(argv[1], std::ios::binary);
+	if (!in) {
+		fprintf(stderr, "%s: can't open %s\n", argv[0], argv[1]);
+		return 1;
+	}
+
+	std::vector<Core6502::Trace::Record> records;
+	std::vector<uint64_t> cycles;
+	if (!Core6502::Trace::read(in, records, cycles)) {
+		fprintf(stderr, "%s: %s isn't a trace dump\n", argv[0], argv[1]);
+		return 1;
+	}
+
+	for (size_t i = 0; i < records.size(); i++)
+		std::cout << Core6502::Trace::format(records[i], cycles[i]) << "\n";
+
+	return 0;
+
+}
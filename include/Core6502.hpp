@@ -10,22 +10,60 @@
 
 #include <stdio.h>
 #include <stdint.h>
-#include <map>
+#include <stddef.h>
 #include "Core6502Operations.hpp"
+#include "Core6502Bus.hpp"
+#include "Core6502BlockCache.hpp"
+#ifdef CORE6502_JIT
+#include "Core6502JIT.hpp"
+#endif
 
 namespace Core6502{
 
+    class Trace;
+    class Profiler;
+    class Scheduler;
+    class Debugger;
+    class Recorder;
+
+    // Execution cores.  Table dispatches through CPU::instructions and honors overrides.
+    // Switch runs the default opcode table as one inlined case per opcode (computed goto
+    // on GCC/Clang) and ignores changes made to CPU::instructions.  Cached runs predecoded
+    // basic blocks from CPU::blockCache, also ignoring CPU::instructions, and falls back to
+    // the switch core for single instructions and uncacheable code.  JIT, only in the
+    // Core6502JIT library, runs x86-64 translations of hot code (see Core6502JIT.hpp).
+    enum class Interpreter : uint8_t {
+        Table,
+        Switch,
+        Cached,
+#ifdef CORE6502_JIT
+        JIT,
+#endif
+    };
+
+    // Core used when none is passed to the constructor
+#ifndef CORE6502_DEFAULT_INTERPRETER
+#define CORE6502_DEFAULT_INTERPRETER Core6502::Interpreter::Table
+#endif
+
     class CPU {
     
     // Constructors/Destructors
     public:
         CPU();
-        CPU(uint8_t * memPtr);
+        CPU(uint8_t * memPtr, Core6502::Interpreter interpreter = CORE6502_DEFAULT_INTERPRETER);
+        ~CPU();
+
+        // Keeps the instruction table cache line aligned on the heap
+        static void * operator new(size_t size);
+        static void operator delete(void * ptr);
+
     // Internals
     public:
-        // Map of operations.  Can be used to overload default operations or add functionality
-        // to undocumented operations like the NES Processor.
-        std::map<uint8_t, struct Instruction> instructions;
+        // Table of operations indexed by opcode.  Can be used to overload default operations or add
+        // functionality to undocumented operations like the NES Processor.  Unassigned opcodes
+        // execute as a two cycle NOP.
+        alignas(64) struct Instruction instructions[0x100];
 
         // Registers
         struct {
@@ -51,18 +89,83 @@ namespace Core6502{
             uint8_t raw;
         } status;
 
-        volatile uint8_t * mem;
+        // N/Z/C/V while a core runs with Flags::Lazy (see Core6502Flags.hpp).  Stale otherwise.
+        struct {
+            uint8_t negative;       // Bit 7 is N
+            uint8_t zero;           // Z when 0
+            uint8_t carry;
+            uint8_t overflow;
+        } lazyFlags;
+
+        // Flat 64 KiB of RAM the bus maps by default
+        uint8_t * mem;
+
+        // Page table every CPU memory access goes through.  Remap pages to add ROM, I/O
+        // or mirrors on top of mem.
+        Core6502::Bus bus;
 
         uint8_t cyclesRemaining;
 
+        // Cycles the instruction just run takes beyond Instruction::cycles: one when an indexed
+        // read (abs,X abs,Y (zp),Y) crosses a page, one for a taken branch and another when it
+        // lands on a different page.  Set by the addressing methods and branch operations, the
+        // cores add it in and clear it after each instruction.
+        uint8_t extraCycles;
+
+        uint64_t totalCycles;       // Cycles clocked since construction
+
+        Core6502::Interpreter interpreter;  // Execution core selected at construction
+
+        Core6502::BlockCache * blockCache;  // Only allocated for Interpreter::Cached, NULL otherwise
+#ifdef CORE6502_JIT
+        Core6502::JIT * jit;                // Only allocated for Interpreter::JIT, NULL otherwise
+#endif
+
+        // Records every instruction run when set and built with CORE6502_TRACE (see
+        // Core6502Trace.hpp).  NULL by default, owned by the caller.
+        Core6502::Trace * trace;
+
+        // Counts executions and cycles when set and built with CORE6502_PROFILE (see
+        // Core6502Profiler.hpp).  NULL by default, owned by the caller.
+        Core6502::Profiler * profiler;
+
+        // Timed device events fired as totalCycles passes them (see Core6502Scheduler.hpp).
+        // NULL by default, owned by the caller.
+        Core6502::Scheduler * scheduler;
+
+        // Breakpoints and watchpoints run() and runUntil() stop on (see Core6502Debugger.hpp).
+        // NULL by default, owned by the caller.
+        Core6502::Debugger * debugger;
+
+        // Logs irq() and nmi() calls for replay (see Core6502Replay.hpp).  Set by Recorder.
+        Core6502::Recorder * recorder;
+
+        // Idle loops.  run() and runUntil() without a predicate fast-forward through spin loops
+        // that can't change anything: a short loop of instructions that don't write memory or
+        // the stack, reading only RAM/ROM, that comes back round with every register and flag
+        // unchanged.  Once one pass proves that, the remaining passes that fit in the cycle
+        // budget are skipped, ending on the same cycle and state as running them would.  Every
+        // core looks for a loop at the start of each call; the cached core also checks each
+        // block that jumps back to itself.  Skipping is off while a trace or profiler is attached.
+        bool idleSkipping;                  // On by default
+        uint64_t idleCyclesSkipped;         // Cycles fast-forwarded since construction
+
+        static bool sideEffectFree(uint8_t opCode);     // Opcode can't write memory or the stack
+
     // Fetch Methods
     public:
         uint8_t fetchByte();                            // Fetches current byte and increments PC
         uint8_t fetchFromMemory(Core6502::Instruction& );  // Fetches value from address 
+        uint8_t read(uint16_t addr);                    // Reads a byte through the bus
+        void write(uint16_t addr, uint8_t value);       // Writes a byte through the bus
 
     // Control Methods
     public:
         void clock();               // Clocks processor
+        uint8_t step();             // Finishes the current instruction, executes the next and returns cycles used
+        uint32_t run(uint32_t cycles);                  // Clocks processor for cycles, returns overshoot of last instruction
+        uint32_t runUntil(uint16_t pc, uint32_t cycles); // Runs until PC is reached or cycles are used, returns cycles run
+        uint32_t runUntil(bool (*predicate)(Core6502::CPU&), uint32_t cycles);  // Runs until predicate is true
         void irq();                 // Interrupts processor if enabled
         void nmi();                 // Performs interrupt regardless of interrupt enabled status
         void reset();               // Resets Processor
@@ -81,12 +184,26 @@ namespace Core6502{
         static uint16_t indirectAddr(Core6502::CPU&);
         static uint16_t relativeAddr(Core6502::CPU&);
         static uint16_t accumlatorAddr(Core6502::CPU&);
-        
+
     private:
         void setupInstructionMap();
+        uint8_t execute();                                                      // Executes one instruction
+        uint32_t runLoop(uint32_t cycles, int32_t stopPC, bool (*predicate)(Core6502::CPU&));
+        uint32_t interpret(uint32_t cycles, int32_t stopPC, bool (*predicate)(Core6502::CPU&));  // Switch core
+        uint32_t runCached(uint32_t cycles, int32_t stopPC, bool (*predicate)(Core6502::CPU&));  // Block cache core
+        uint32_t skipIdle(uint32_t cycles, int32_t stopPC);     // Fast-forwards an idle loop at PC, returns cycles used
+        uint32_t runScheduled(uint32_t cycles, int32_t stopPC, bool (*predicate)(Core6502::CPU&));  // runLoop() between events
+        uint32_t runEntry(uint32_t cycles, int32_t stopPC, bool (*predicate)(Core6502::CPU&));      // Shared by run() and runUntil()
+
+        // Owns blockCache and jit, so copies would free them twice
+        CPU(const CPU &) = delete;
+        CPU & operator=(const CPU &) = delete;
     };
 
 
 }
 
+// Inline fetch and addressing methods plus compile-time addressing modes
+#include "Core6502Addressing.hpp"
+
 #endif /* Core6502_hpp */
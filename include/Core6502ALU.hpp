@@ -0,0 +1,62 @@
+//
+//  Core6502ALU.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+#ifndef Core6502ALU_hpp
+#define Core6502ALU_hpp
+
+#include <stdint.h>
+
+namespace Core6502 {
+namespace ALU {
+
+    // Binary ADC, SBC and compares, returning the result in the low byte and C/Z/V/N in their
+    // status bits in the high byte, so a core applies all four flags with one masked store
+    // (Flags::setFlags) instead of a bitfield write each.  N and Z come from nz, C and V are
+    // worked out without branches.
+
+    enum {
+        FlagC = 0x01,
+        FlagZ = 0x02,
+        FlagV = 0x20,
+        FlagN = 0x40,
+
+        // What each instruction sets
+        ArithmeticFlags = FlagN | FlagZ | FlagC | FlagV,
+        CompareFlags = FlagN | FlagZ | FlagC,
+    };
+
+    // N and Z of every result
+    extern const uint8_t nz[0x100];
+
+    inline uint16_t adc(uint8_t a, uint8_t operand, uint8_t carry) {
+        uint32_t sum = a + operand + carry;
+        uint8_t result = (uint8_t)sum;
+
+        // V when both inputs have the same sign and the result doesn't
+        uint8_t flags = nz[result] | (sum >> 8) | (((a ^ result) & (operand ^ result) & 0x80) >> 2);
+        return result | flags << 8;
+    }
+
+    // Carry is the borrow SBC subtracts, and comes out set when it borrowed
+    inline uint16_t sbc(uint8_t a, uint8_t operand, uint8_t borrow) {
+        uint32_t difference = (uint32_t)a - operand - borrow;
+        uint8_t result = (uint8_t)difference;
+
+        // V when the inputs have different signs and the result has the operand's
+        uint8_t flags = nz[result] | ((difference >> 8) & FlagC) | (((a ^ operand) & (a ^ result) & 0x80) >> 2);
+        return result | flags << 8;
+    }
+
+    // C/Z/N of CMP, CPX and CPY
+    inline uint8_t compare(uint8_t reg, uint8_t operand) {
+        uint32_t difference = (uint32_t)reg - operand;
+        return nz[(uint8_t)difference] | (~difference >> 8 & FlagC);
+    }
+
+}
+}
+
+#endif /* Core6502ALU_hpp */
@@ -0,0 +1,281 @@
+//
+//  Core6502Addressing.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+#ifndef Core6502Addressing_hpp
+#define Core6502Addressing_hpp
+
+#include <stdint.h>
+#include "Core6502.hpp"
+
+// Fetch, memory access and addressing methods live here so operations can inline them
+
+inline uint8_t Core6502::CPU::read(uint16_t addr) {
+    return bus.read(addr);
+}
+
+inline void Core6502::CPU::write(uint16_t addr, uint8_t value) {
+    bus.write(addr, value);
+}
+
+inline uint8_t Core6502::CPU::fetchByte() {
+
+    // Grab value from memory at PC index and increment PC
+    uint8_t value = read(registers.PC);
+    registers.PC++;
+
+    return value;
+
+}
+
+inline uint8_t Core6502::CPU::fetchFromMemory(Core6502::Instruction &instruction) {
+
+    // Perform addressing operation
+    if (instruction.addressFunction != Core6502::CPU::immediate)
+        return read(instruction.addressFunction(*this));
+    else
+        return instruction.addressFunction(*this);
+
+}
+
+namespace Core6502 {
+namespace Addressing {
+
+    // Effective address from an instruction's already fetched operand.  Shared by the
+    // fetching addressing methods below and the predecoded modes used by the block cache,
+    // where PC already points past the instruction.
+
+    inline uint16_t zeroPageX(Core6502::CPU &cpu, uint16_t operand) {
+        // Add value of X register, wrapping within the zero page
+        return (uint8_t)(operand + cpu.registers.X);
+    }
+    inline uint16_t zeroPageY(Core6502::CPU &cpu, uint16_t operand) {
+        // Add value of Y register, wrapping within the zero page
+        return (uint8_t)(operand + cpu.registers.Y);
+    }
+    inline uint8_t pageCrossed(uint16_t base, uint8_t index) {
+        // 1 when adding index carries into the high byte
+        return ((base & 0xFF) + index) >> 8;
+    }
+    inline uint16_t absoluteX(Core6502::CPU &cpu, uint16_t operand) {
+        // Add offset from X register, a read takes a cycle more across a page
+        cpu.extraCycles = pageCrossed(operand, cpu.registers.X);
+        return operand + cpu.registers.X;
+    }
+    inline uint16_t absoluteY(Core6502::CPU &cpu, uint16_t operand) {
+        // Add offset from Y register, a read takes a cycle more across a page
+        cpu.extraCycles = pageCrossed(operand, cpu.registers.Y);
+        return operand + cpu.registers.Y;
+    }
+    inline uint16_t indirectX(Core6502::CPU &cpu, uint16_t operand) {
+        // Add value in register X to the zero page offset
+        uint8_t zero_addr = operand + cpu.registers.X;
+
+        // Read 16-bit address from zero page address
+        uint16_t effective_addr =  cpu.read(zero_addr);
+                 effective_addr += (cpu.read(zero_addr + 1) << 8);
+
+        return effective_addr;
+    }
+    inline uint16_t indirectY(Core6502::CPU &cpu, uint16_t operand) {
+        // Fetch 16-bit address from zero page memory
+        uint8_t offset = operand;
+        uint16_t effective_addr =  cpu.read(offset);
+                 effective_addr += (cpu.read(offset + 1) << 8);
+
+        // Add Y to effecting address, a read takes a cycle more across a page
+        cpu.extraCycles = pageCrossed(effective_addr, cpu.registers.Y);
+        effective_addr += cpu.registers.Y;
+
+        return effective_addr;
+    }
+    inline uint16_t indirect(Core6502::CPU &cpu, uint16_t operand) {
+        // Fetch 16-bit address from address specified by passed in address
+        // Note.  This implementation contains the page boundary bug in the
+        // Original 6502.  See http://obelisk.me.uk/6502/reference.html#JMP
+        // for details.
+        uint16_t effectiveAddr =  cpu.read(operand);
+
+        // Implement page boundary bug
+        if ((operand & 0xFF) == 0xFF) effectiveAddr += (cpu.read((operand & 0xFF00)) << 8);
+        else effectiveAddr += (cpu.read(operand + 1) << 8);
+
+        return effectiveAddr;
+    }
+    inline uint16_t relative(Core6502::CPU &cpu, uint16_t operand) {
+        // Add signed offset to PC
+        return cpu.registers.PC + (int8_t)operand;
+    }
+    inline uint16_t direct(Core6502::CPU &, uint16_t operand) {
+        // Zero page and absolute operands are the address
+        return operand;
+    }
+
+}
+}
+
+inline uint16_t Core6502::CPU::immediate(Core6502::CPU &cpu) {
+    return cpu.fetchByte();
+}
+inline uint16_t Core6502::CPU::zeroPageAddr(Core6502::CPU &cpu) {
+    // Return fetched byte
+    return cpu.fetchByte();
+}
+inline uint16_t Core6502::CPU::zeroPageXAddr(Core6502::CPU &cpu) {
+    return Core6502::Addressing::zeroPageX(cpu, cpu.fetchByte());
+}
+inline uint16_t Core6502::CPU::zeroPageYAddr(Core6502::CPU &cpu) {
+    return Core6502::Addressing::zeroPageY(cpu, cpu.fetchByte());
+}
+inline uint16_t Core6502::CPU::absoluteAddr(Core6502::CPU &cpu) {
+    // Fetch 16-bit address
+    uint16_t addr  = cpu.fetchByte();
+             addr |= (cpu.fetchByte() << 8);
+
+    return addr;
+}
+inline uint16_t Core6502::CPU::absoluteXAddr(Core6502::CPU &cpu) {
+    return Core6502::Addressing::absoluteX(cpu, absoluteAddr(cpu));
+}
+inline uint16_t Core6502::CPU::absoluteYAddr(Core6502::CPU &cpu) {
+    return Core6502::Addressing::absoluteY(cpu, absoluteAddr(cpu));
+}
+inline uint16_t Core6502::CPU::indirectXAddr(Core6502::CPU &cpu) {
+    return Core6502::Addressing::indirectX(cpu, cpu.fetchByte());
+}
+inline uint16_t Core6502::CPU::indirectYAddr(Core6502::CPU &cpu) {
+    return Core6502::Addressing::indirectY(cpu, cpu.fetchByte());
+}
+inline uint16_t Core6502::CPU::indirectAddr(Core6502::CPU &cpu) {
+    return Core6502::Addressing::indirect(cpu, absoluteAddr(cpu));
+}
+inline uint16_t Core6502::CPU::relativeAddr(Core6502::CPU &cpu) {
+    // Fetch signed byte first so PC points past the instruction
+    uint8_t offset = cpu.fetchByte();
+    return Core6502::Addressing::relative(cpu, offset);
+}
+inline uint16_t Core6502::CPU::accumlatorAddr(Core6502::CPU &cpu) {
+    return cpu.registers.A;
+}
+
+namespace Core6502 {
+namespace Addressing {
+
+    // Compile-time addressing modes for the operation templates in
+    // Core6502OperationTemplates.hpp.  Each mode provides:
+    //  address(cpu)        - effective address (the operand itself for immediate/accumulator)
+    //  read(cpu)           - operand value
+    //  isAccumulator()     - true when the operand is the accumulator
+    //
+    // Indexed modes leave CPU::extraCycles set when a read crosses a page.  address() is what
+    // writes and read-modify-writes use, and their counts already include that cycle, so it
+    // clears it again.
+
+    struct Implied {
+        bool isAccumulator() const { return false; }
+        uint16_t address(Core6502::CPU &) const { return 0; }
+    };
+
+    struct Immediate {
+        bool isAccumulator() const { return false; }
+        uint16_t address(Core6502::CPU &cpu) const { return Core6502::CPU::immediate(cpu); }
+        uint8_t read(Core6502::CPU &cpu) const { return cpu.fetchByte(); }
+    };
+
+    struct Accumulator {
+        bool isAccumulator() const { return true; }
+        uint16_t address(Core6502::CPU &cpu) const { return Core6502::CPU::accumlatorAddr(cpu); }
+        uint8_t read(Core6502::CPU &cpu) const { return cpu.registers.A; }
+    };
+
+    // Modes that resolve to a memory address
+    template <uint16_t (*Address)(Core6502::CPU&), bool Indexed = false>
+    struct Memory {
+        bool isAccumulator() const { return false; }
+        uint16_t address(Core6502::CPU &cpu) const {
+            uint16_t addr = Address(cpu);
+            if (Indexed) cpu.extraCycles = 0;
+            return addr;
+        }
+        uint8_t read(Core6502::CPU &cpu) const { return cpu.read(Address(cpu)); }
+    };
+
+    typedef Memory<Core6502::CPU::zeroPageAddr>         ZeroPage;
+    typedef Memory<Core6502::CPU::zeroPageXAddr>        ZeroPageX;
+    typedef Memory<Core6502::CPU::zeroPageYAddr>        ZeroPageY;
+    typedef Memory<Core6502::CPU::absoluteAddr>         Absolute;
+    typedef Memory<Core6502::CPU::absoluteXAddr, true>  AbsoluteX;
+    typedef Memory<Core6502::CPU::absoluteYAddr, true>  AbsoluteY;
+    typedef Memory<Core6502::CPU::indirectXAddr>        IndirectX;
+    typedef Memory<Core6502::CPU::indirectYAddr, true>  IndirectY;
+    typedef Memory<Core6502::CPU::indirectAddr>         Indirect;
+    typedef Memory<Core6502::CPU::relativeAddr>         Relative;
+
+    // Runtime mode taken from an Instruction.  Backs the pointer based operations
+    // so user overrides of addressFunction keep working.
+    struct Dynamic {
+        Core6502::Instruction &op;
+
+        explicit Dynamic(Core6502::Instruction &op) : op(op) {}
+
+        bool isAccumulator() const { return op.addressFunction == Core6502::CPU::accumlatorAddr; }
+        uint16_t address(Core6502::CPU &cpu) const {
+            uint16_t addr = op.addressFunction(cpu);
+            cpu.extraCycles = 0;
+            return addr;
+        }
+        uint8_t read(Core6502::CPU &cpu) const { return cpu.fetchFromMemory(op); }
+    };
+
+    // Predecoded modes used by the block cache.  The operand bytes were read when the block
+    // was decoded and PC already points past the instruction.
+    struct DecodedImplied : Implied {
+        explicit DecodedImplied(uint16_t) {}
+    };
+
+    struct DecodedAccumulator : Accumulator {
+        explicit DecodedAccumulator(uint16_t) {}
+    };
+
+    struct DecodedImmediate {
+        uint16_t operand;
+
+        explicit DecodedImmediate(uint16_t operand) : operand(operand) {}
+
+        bool isAccumulator() const { return false; }
+        uint16_t address(Core6502::CPU &) const { return operand; }
+        uint8_t read(Core6502::CPU &) const { return (uint8_t)operand; }
+    };
+
+    template <uint16_t (*Resolve)(Core6502::CPU&, uint16_t), bool Indexed = false>
+    struct Decoded {
+        uint16_t operand;
+
+        explicit Decoded(uint16_t operand) : operand(operand) {}
+
+        bool isAccumulator() const { return false; }
+        uint16_t address(Core6502::CPU &cpu) const {
+            uint16_t addr = Resolve(cpu, operand);
+            if (Indexed) cpu.extraCycles = 0;
+            return addr;
+        }
+        uint8_t read(Core6502::CPU &cpu) const { return cpu.read(Resolve(cpu, operand)); }
+    };
+
+    typedef Decoded<direct>             DecodedZeroPage;
+    typedef Decoded<zeroPageX>          DecodedZeroPageX;
+    typedef Decoded<zeroPageY>          DecodedZeroPageY;
+    typedef Decoded<direct>             DecodedAbsolute;
+    typedef Decoded<absoluteX, true>    DecodedAbsoluteX;
+    typedef Decoded<absoluteY, true>    DecodedAbsoluteY;
+    typedef Decoded<indirectX>          DecodedIndirectX;
+    typedef Decoded<indirectY, true>    DecodedIndirectY;
+    typedef Decoded<indirect>           DecodedIndirect;
+    typedef Decoded<relative>           DecodedRelative;
+
+}
+}
+
+#endif /* Core6502Addressing_hpp */
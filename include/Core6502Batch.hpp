@@ -0,0 +1,72 @@
+//
+//  Core6502Batch.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+#ifndef Core6502Batch_hpp
+#define Core6502Batch_hpp
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+namespace Core6502 {
+
+    class CPU;
+
+    // Runs many CPUs together, for search and fuzzing workloads where every CPU runs the same
+    // program on its own memory.  CPUs are added as lanes in groups of Width.  During run()
+    // each group's registers and flags live in structure-of-arrays form.  While every lane in
+    // a group is at the same opcode, and that opcode has a lockstep kernel, the group executes
+    // it as one loop across lanes, which the compiler turns into SSE2 or AVX2 code (build with
+    // -mavx2 or -march=native for the wider lanes).  Memory is still accessed per lane through
+    // each CPU's bus.
+    //
+    // When lanes diverge, the lanes at the lowest PC step on their own through the default
+    // opcode table until the group lines up again.  Lanes that took a forward branch wait for
+    // the rest to catch up instead of drifting further apart.
+    //
+    // Lanes run the default opcode table.  Changes to CPU::instructions, the CPU's selected
+    // interpreter and CPU::scheduler are ignored.
+    class Batch {
+
+    // Constructors/Destructors
+    public:
+        Batch();
+        ~Batch();
+
+    // Lanes
+    public:
+        static const int Width = 32;        // Lanes per group, one AVX2 register of bytes
+
+        size_t add(Core6502::CPU & cpu);    // Adds cpu as the next lane and returns its index
+        size_t size() const;                // Number of lanes
+
+    // Execution
+    public:
+        // Runs every lane for cycles, leaving each CPU as CPU::run(cycles) would.  Returns the
+        // number of instructions executed across all lanes.
+        uint64_t run(uint32_t cycles);
+
+    // Statistics
+    public:
+        uint64_t lockstepInstructions;      // Lane instructions executed by lockstep kernels
+        uint64_t scalarInstructions;        // Lane instructions executed one lane at a time
+
+    // Internals
+    public:
+        struct Group;                       // Registers of Width lanes, see Core6502Batch.cpp
+
+    private:
+        std::vector<Group *> groups;
+        size_t lanes;
+
+        uint64_t runGroup(Group & group, uint32_t cycles);
+        bool lockstep(Group & group, uint8_t opCode);
+        void scalar(Group & group, int lane);
+    };
+
+}
+
+#endif /* Core6502Batch_hpp */
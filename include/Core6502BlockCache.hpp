@@ -0,0 +1,86 @@
+//
+//  Core6502BlockCache.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+#ifndef Core6502BlockCache_hpp
+#define Core6502BlockCache_hpp
+
+#include <stdint.h>
+#include "Core6502Bus.hpp"
+
+namespace Core6502 {
+
+    class CPU;
+
+    // Predecoded basic blocks keyed by start PC, used by Interpreter::Cached.  A block runs from
+    // its start to the first branch, jump, call, return or break, and holds each instruction's
+    // operation, operand bytes and cycles so loops skip fetch and decode.
+    //
+    // Pages holding cached code get a bus write trap.  The first write to such a page drops
+    // every block on it and removes the trap until code there is decoded again.  Code
+    // written straight into CPU::mem, or through a mirror of the page, bypasses the
+    // trap; call flush() afterwards.
+    class BlockCache {
+
+    // Constructors/Destructors
+    public:
+        BlockCache(Core6502::Bus & bus);
+        ~BlockCache();
+
+    // Blocks
+    public:
+        static const int MaxBlockLength = 16;       // Instructions per block
+        static const int Lines = 512;               // Direct mapped on start PC
+
+        struct DecodedInstruction {
+            void (*operation)(Core6502::CPU&, uint16_t operand);
+            uint16_t operand;
+            uint16_t next;          // PC after the instruction
+            uint8_t cycles;
+        };
+
+        struct Block {
+            uint16_t start;
+            uint16_t end;           // First byte past the block
+            uint8_t count;          // Instructions, 0 when the line is empty
+            bool idle;              // Side effect free and ends jumping back to start
+            uint8_t pages[2];       // First and last page the block's bytes sit on
+            uint32_t generation[2]; // Page generations at decode time
+            uint32_t cycles;        // Most cycles the whole block can take
+            struct DecodedInstruction instructions[MaxBlockLength];
+        };
+
+        // Returns the block starting at pc, decoding it on a miss.  The block is empty when
+        // pc sits on a page that can't be cached (I/O, or rewritten too often).
+        const Block & lookup(uint16_t pc);
+
+        void flush();               // Drops every block
+
+        // Set whenever a cached code page is written.  The interpreter clears it before a
+        // block and abandons the block once it's set.
+        bool invalidated;
+
+    // Statistics
+    public:
+        uint64_t hits;
+        uint64_t misses;
+
+    private:
+        Core6502::Bus & bus;
+        int trap;
+        uint32_t mapGeneration;
+
+        Block * lines;
+        uint32_t pageGeneration[0x100];
+        uint16_t pageRewrites[0x100];   // Code invalidations per page since the last flush
+
+        void decode(Block & block, uint16_t pc);
+        bool cacheable(uint8_t page) const;
+        static void codeWritten(void * context, uint16_t addr, uint8_t value);
+    };
+
+}
+
+#endif /* Core6502BlockCache_hpp */
@@ -0,0 +1,128 @@
+//
+//  Core6502Bus.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+#ifndef Core6502Bus_hpp
+#define Core6502Bus_hpp
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace Core6502 {
+
+    // Memory mapped I/O callbacks
+    typedef uint8_t (*BusReadCallback)(void * context, uint16_t addr);
+    typedef void (*BusWriteCallback)(void * context, uint16_t addr, uint8_t value);
+
+    // 64 KiB address space split into 256 byte pages.  Each page either points straight at
+    // its 256 bytes (RAM/ROM, a single indexed load) or at read/write callbacks (I/O).
+    class Bus {
+
+    // Constructors/Destructors
+    public:
+        Bus();
+
+    // Page Table
+    public:
+        // Direct pointers to the start of each page's data.  NULL sends the access down the
+        // slow path, to the page's handler or past its traps.
+        uint8_t * readPage[0x100];
+        uint8_t * writePage[0x100];
+
+        // Slow path handlers, only used when the direct pointer is NULL
+        struct Handler {
+            BusReadCallback read;       // NULL reads as 0
+            BusWriteCallback write;     // NULL ignores writes
+            void * context;
+        } handlers[0x100];
+
+        // Every read of a page without memory behind it (I/O or unmapped) calls input instead
+        // of the page's handler when set, so record/replay can log or stand in for what devices
+        // return (see Core6502Replay.hpp)
+        typedef uint8_t (*InputCallback)(void * context, uint16_t addr, const Handler & handler);
+        InputCallback input;
+        void * inputContext;
+
+    // Access Methods
+    public:
+        uint8_t read(uint16_t addr);
+        void write(uint16_t addr, uint8_t value);
+
+    // Mapping Methods.  Addresses are rounded down and lengths up to whole pages.
+    public:
+        void mapRAM(uint16_t start, uint32_t length, uint8_t * data);           // Read/write memory
+        void mapROM(uint16_t start, uint32_t length, const uint8_t * data);     // Read only, writes ignored
+        void mapIO(uint16_t start, uint32_t length, BusReadCallback read, BusWriteCallback write, void * context);
+        void mirror(uint16_t start, uint32_t length, uint16_t source);           // Repeats pages starting at source
+        void unmap(uint16_t start, uint32_t length);                            // Reads 0, ignores writes
+
+        // Memory mapped at a page, read trapped or not.  NULL for I/O and unmapped pages.
+        const uint8_t * mapped(uint8_t page) const { return directReadPage[page]; }
+
+        uint32_t mapGeneration;     // Bumped by every mapping call so caches can notice remaps
+
+        uint32_t slowReads;         // Reads that took the slow path, wraps
+
+    // Write Traps.  Pages with any trap set take the slow path on writes, and every trap on
+    // the page sees the write before it lands.  Traps stay in place across remapping.
+    public:
+        static const int MaxWriteTraps = 8;
+
+        int addWriteTrap(BusWriteCallback callback, void * context);   // Returns trap id, -1 when full
+        void removeWriteTrap(int trap);
+        void trapPage(int trap, uint8_t page);
+        void untrapPage(int trap, uint8_t page);
+
+        // Reports a change made straight to the page's memory, behind the bus, to every trap
+        // on the page as a write to its first byte
+        void invalidatePage(uint8_t page);
+
+    // Read Traps.  The same for reads: pages with any read trap set take the slow path, and
+    // every read trap on the page is called with the address and the value read.
+    public:
+        static const int MaxReadTraps = 4;
+
+        int addReadTrap(BusWriteCallback callback, void * context);    // Returns trap id, -1 when full
+        void removeReadTrap(int trap);
+        void trapPageReads(int trap, uint8_t page);
+        void untrapPageReads(int trap, uint8_t page);
+
+    private:
+        struct Trap {
+            BusWriteCallback callback;
+            void * context;
+        } traps[MaxWriteTraps], readTraps[MaxReadTraps];
+
+        uint8_t trapMask[0x100];            // Bit per trap set on each page
+        uint8_t readTrapMask[0x100];
+        uint8_t * directWritePage[0x100];   // Mapped write pointer, kept while writePage is trapped
+        uint8_t * directReadPage[0x100];    // And read pointer, while readPage is
+
+        void setPage(uint32_t page, uint8_t * read, uint8_t * write, const Handler & handler);
+        uint8_t readSlow(uint16_t addr);
+        void writeSlow(uint16_t addr, uint8_t value);
+    };
+
+}
+
+inline uint8_t Core6502::Bus::read(uint16_t addr) {
+
+    // RAM/ROM pages are a single indexed load
+    uint8_t * page = readPage[addr >> 8];
+    if (page) return page[addr & 0xFF];
+
+    return readSlow(addr);
+
+}
+
+inline void Core6502::Bus::write(uint16_t addr, uint8_t value) {
+
+    uint8_t * page = writePage[addr >> 8];
+    if (page) page[addr & 0xFF] = value;
+    else writeSlow(addr, value);
+
+}
+
+#endif /* Core6502Bus_hpp */
@@ -0,0 +1,111 @@
+//
+//  Core6502Debugger.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+#ifndef Core6502Debugger_hpp
+#define Core6502Debugger_hpp
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Core6502.hpp"
+
+namespace Core6502 {
+
+    // PC breakpoints and memory watchpoints for one CPU.  Attach to CPU::debugger and run()
+    // and runUntil() stop at the first instruction boundary where one hits, leaving stopped
+    // saying why.
+    //
+    // Nothing armed costs nothing: the cores only see a debugger when it has a breakpoint or
+    // watchpoint, and then check it through the predicate path runUntil() already has (the JIT
+    // hands over to the switch core, idle loops aren't skipped).  Breakpoints are a 64K-bit map
+    // of PCs looked at only when the PC's page has any.  Watchpoints are bus read and write
+    // traps on just their pages, so every other page keeps its direct pointer; the watched
+    // access completes and the run stops after that instruction.  A run starting on a
+    // breakpoint runs that instruction, so calling run() again continues.
+    //
+    // Read watchpoints are meant for data.  Whether instruction fetches hit them depends on
+    // the core.  clock() and step() don't stop, but still record watchpoints hit.  Nothing is
+    // recorded while the debugger isn't attached to CPU::debugger.
+    class Debugger {
+
+    // Constructors/Destructors
+    public:
+        Debugger(Core6502::CPU & cpu);
+        ~Debugger();
+
+    // Breakpoints
+    public:
+        void addBreakpoint(uint16_t pc);
+        void removeBreakpoint(uint16_t pc);
+        inline bool breakpoint(uint16_t pc) const;
+
+    // Watchpoints
+    public:
+        enum : uint8_t {
+            Read = 0x01,
+            Write = 0x02,
+        };
+
+        // access is Read, Write or both.  False when the bus had no trap left for it.
+        bool addWatchpoint(uint16_t addr, uint8_t access);
+        void removeWatchpoint(uint16_t addr, uint8_t access);
+        uint8_t watchpoint(uint16_t addr) const;    // Accesses watched at addr
+
+        void clear();                               // Removes every breakpoint and watchpoint
+        bool armed() const { return breakpoints || watchpoints; }
+
+    // Last Stop
+    public:
+        enum class Stop : uint8_t {
+            None,                                   // Ran out of cycles, reached its PC or predicate
+            Breakpoint,
+            Watchpoint,
+        };
+
+        Stop stopped;               // Why the last run() or runUntil() returned
+        uint16_t address;           // Breakpoint PC, or the watched address accessed
+        uint8_t access;             // Read or Write for a watchpoint
+
+        uint64_t hits;              // Breakpoints and watchpoints hit since construction
+
+        // Starts a run, true when armed and check() should stand in for the caller's
+        // predicate.  Called by the CPU.
+        bool begin(bool (*predicate)(Core6502::CPU&));
+        static bool check(Core6502::CPU & cpu);
+
+    private:
+        Core6502::CPU & cpu;
+
+        uint8_t breakpointMap[0x10000 / 8];
+        uint16_t pageBreakpoints[0x100];
+        uint32_t breakpoints;
+
+        uint8_t readMap[0x10000 / 8], writeMap[0x10000 / 8];
+        uint16_t pageReads[0x100], pageWrites[0x100];
+        uint32_t watchpoints;
+        int readTrap, writeTrap;
+
+        bool (*predicate)(Core6502::CPU&);          // Caller's, NULL for none
+        bool resuming;                              // Before the first instruction of a run
+        bool watchHit;                              // Since the run began
+
+        static bool test(const uint8_t * map, uint16_t addr) { return map[addr >> 3] & (1 << (addr & 7)); }
+        bool watch(uint8_t * map, uint16_t * pages, uint16_t addr, int trap, bool reads);
+        void unwatch(uint8_t * map, uint16_t * pages, uint16_t addr, int trap, bool reads);
+        static void accessed(Core6502::Debugger & debugger, uint16_t addr, uint8_t access);
+        static void read(void * context, uint16_t addr, uint8_t value);
+        static void written(void * context, uint16_t addr, uint8_t value);
+
+        Debugger(const Debugger &) = delete;
+        Debugger & operator=(const Debugger &) = delete;
+    };
+
+}
+
+inline bool Core6502::Debugger::breakpoint(uint16_t pc) const {
+    return pageBreakpoints[pc >> 8] && test(breakpointMap, pc);
+}
+
+#endif /* Core6502Debugger_hpp */
@@ -0,0 +1,38 @@
+//
+//  Core6502Decimal.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+#ifndef Core6502Decimal_hpp
+#define Core6502Decimal_hpp
+
+#include <stdint.h>
+
+namespace Core6502 {
+namespace Decimal {
+
+    // ADC and SBC with the D flag set, as the NMOS 6502 does them, precomputed for every carry,
+    // accumulator and operand so decimal mode is one table lookup.  That includes invalid BCD
+    // digits and the flags the NMOS part gets "wrong": Z comes from the binary sum, and N and
+    // V from the sum after the low digit is adjusted but before the high one is.
+    //
+    // Tables are indexed by index() and filled in by initialize(), which every CPU
+    // constructor calls.
+
+    inline uint32_t index(uint8_t carry, uint8_t a, uint8_t operand) {
+        return (uint32_t)carry << 16 | a << 8 | operand;
+    }
+
+    // Result in the low byte, C/Z/V/N in their status bits in the high byte, as ALU::adc
+    extern uint16_t adc[2 * 0x10000];
+
+    // Result only, SBC sets flags as in binary mode.  Carry is the borrow SBC subtracts.
+    extern uint8_t sbc[2 * 0x10000];
+
+    void initialize();
+
+}
+}
+
+#endif /* Core6502Decimal_hpp */
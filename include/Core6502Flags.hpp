@@ -0,0 +1,115 @@
+//
+//  Core6502Flags.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+#ifndef Core6502Flags_hpp
+#define Core6502Flags_hpp
+
+#include <stdint.h>
+#include "Core6502.hpp"
+#include "Core6502ALU.hpp"
+
+// Flag modes for the operation templates.  Status writes N/Z/C/V straight into the status
+// bitfield.  Lazy keeps them in CPU::lazyFlags instead: N and Z as the last result they came
+// from, C and V as whole bytes.  That turns the read-modify-write of two bitfields on nearly
+// every instruction into plain byte stores, and status is only rebuilt when something looks at
+// it (PHP, BRK, or returning to the host).
+//
+// A core using Lazy calls load() before its first instruction and store() before anything
+// outside the core can see the CPU: returning, calling a predicate, or handing an instruction
+// to another core.  Building with CORE6502_LAZY_FLAGS makes the switch and cached cores use it.
+
+namespace Core6502 {
+namespace Flags {
+
+    struct Status {
+        static void load(Core6502::CPU &) {}
+        static void store(Core6502::CPU &) {}
+
+        // N from bit 7 of negative, Z when zero is 0
+        static void setNZ(Core6502::CPU &cpu, uint8_t negative, uint8_t zero) {
+            cpu.status.bitfield.NegativeFlag = (bool)(negative & 0x80);
+            cpu.status.bitfield.ZeroFlag     = (bool)(zero == 0);
+        }
+        static void setNZ(Core6502::CPU &cpu, uint8_t result) { setNZ(cpu, result, result); }
+        static void setCarry(Core6502::CPU &cpu, bool carry) { cpu.status.bitfield.CarryFlag = carry; }
+        static void setOverflow(Core6502::CPU &cpu, bool overflow) { cpu.status.bitfield.OverflowFlag = overflow; }
+
+        // The flags in mask from their status bits in flags (see Core6502ALU.hpp)
+        static void setFlags(Core6502::CPU &cpu, uint8_t flags, uint8_t mask) {
+            cpu.status.raw = (cpu.status.raw & ~mask) | flags;
+        }
+
+        static bool negative(Core6502::CPU &cpu) { return cpu.status.bitfield.NegativeFlag; }
+        static bool zero(Core6502::CPU &cpu) { return cpu.status.bitfield.ZeroFlag; }
+        static uint8_t carry(Core6502::CPU &cpu) { return cpu.status.bitfield.CarryFlag; }
+        static bool overflow(Core6502::CPU &cpu) { return cpu.status.bitfield.OverflowFlag; }
+
+        static uint8_t raw(Core6502::CPU &cpu) { return cpu.status.raw; }
+        static void setRaw(Core6502::CPU &cpu, uint8_t raw) { cpu.status.raw = raw; }
+    };
+
+    struct Lazy {
+        // Unpacks status into lazyFlags
+        static void load(Core6502::CPU &cpu) {
+            cpu.lazyFlags.negative = cpu.status.bitfield.NegativeFlag << 7;
+            cpu.lazyFlags.zero     = !cpu.status.bitfield.ZeroFlag;
+            cpu.lazyFlags.carry    = cpu.status.bitfield.CarryFlag;
+            cpu.lazyFlags.overflow = cpu.status.bitfield.OverflowFlag;
+        }
+
+        // Rebuilds status from lazyFlags
+        static void store(Core6502::CPU &cpu) {
+            cpu.status.bitfield.NegativeFlag = cpu.lazyFlags.negative >> 7;
+            cpu.status.bitfield.ZeroFlag     = !cpu.lazyFlags.zero;
+            cpu.status.bitfield.CarryFlag    = cpu.lazyFlags.carry;
+            cpu.status.bitfield.OverflowFlag = cpu.lazyFlags.overflow;
+        }
+
+        static void setNZ(Core6502::CPU &cpu, uint8_t negative, uint8_t zero) {
+            cpu.lazyFlags.negative = negative;
+            cpu.lazyFlags.zero = zero;
+        }
+        static void setNZ(Core6502::CPU &cpu, uint8_t result) { setNZ(cpu, result, result); }
+        static void setCarry(Core6502::CPU &cpu, bool carry) { cpu.lazyFlags.carry = carry; }
+        static void setOverflow(Core6502::CPU &cpu, bool overflow) { cpu.lazyFlags.overflow = overflow; }
+
+        // mask is a constant at every call, so the tests fold away
+        static void setFlags(Core6502::CPU &cpu, uint8_t flags, uint8_t mask) {
+            if (mask & ALU::FlagN) cpu.lazyFlags.negative = flags << 1;
+            if (mask & ALU::FlagZ) cpu.lazyFlags.zero = ~flags & ALU::FlagZ;
+            if (mask & ALU::FlagC) cpu.lazyFlags.carry = flags & ALU::FlagC;
+            if (mask & ALU::FlagV) cpu.lazyFlags.overflow = (flags & ALU::FlagV) >> 5;
+        }
+
+        static bool negative(Core6502::CPU &cpu) { return cpu.lazyFlags.negative & 0x80; }
+        static bool zero(Core6502::CPU &cpu) { return !cpu.lazyFlags.zero; }
+        static uint8_t carry(Core6502::CPU &cpu) { return cpu.lazyFlags.carry; }
+        static bool overflow(Core6502::CPU &cpu) { return cpu.lazyFlags.overflow; }
+
+        static uint8_t raw(Core6502::CPU &cpu) { store(cpu); return cpu.status.raw; }
+        static void setRaw(Core6502::CPU &cpu, uint8_t raw) { cpu.status.raw = raw; load(cpu); }
+    };
+
+    // Calls a run predicate with status up to date, picking up anything it changes
+    template <class FlagMode>
+    inline bool observe(Core6502::CPU &cpu, bool (*predicate)(Core6502::CPU&)) {
+        FlagMode::store(cpu);
+        bool result = predicate(cpu);
+        FlagMode::load(cpu);
+        return result;
+    }
+
+}
+}
+
+// Flag mode of the switch and cached cores
+#ifdef CORE6502_LAZY_FLAGS
+#define CORE6502_FLAGS Core6502::Flags::Lazy
+#else
+#define CORE6502_FLAGS Core6502::Flags::Status
+#endif
+
+#endif /* Core6502Flags_hpp */
@@ -0,0 +1,75 @@
+//
+//  Core6502Fleet.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+#ifndef Core6502Fleet_hpp
+#define Core6502Fleet_hpp
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+namespace Core6502 {
+
+    class CPU;
+
+    // Called on the worker thread that finished the instance
+    typedef void (*FleetDoneCallback)(void * context, Core6502::CPU & cpu);
+
+    // Runs many independent CPUs, each with its own memory, on a pool of threads.  Every
+    // instance runs in quanta of cycles on whichever worker holds it.  Workers keep their own
+    // queue of instances, round robin through it, and steal from other workers' queues when
+    // theirs runs dry, so instances that finish early don't leave threads idle.
+    //
+    // Nothing is shared while an instance runs.  Workers only touch their queue's lock and
+    // the count of unfinished instances between quanta, so quantum trades scheduling overhead
+    // against how evenly the load spreads.  Instances must not share memory, I/O callbacks or
+    // anything else a CPU touches while it runs.
+    class Fleet {
+
+    // Constructors/Destructors
+    public:
+        Fleet();
+
+    // Instances
+    public:
+        uint32_t quantum;               // Cycles an instance runs before going back in the queue
+
+        // Adds cpu to run for cycles, or until PC reaches stopPC when it's not -1, and returns
+        // its index.  done is called once the instance finishes.
+        size_t add(Core6502::CPU & cpu, uint64_t cycles, FleetDoneCallback done = NULL,
+                   void * context = NULL, int32_t stopPC = -1);
+        size_t size() const;
+
+    // Execution
+    public:
+        // Runs every instance to completion on threads workers, or one per hardware thread
+        // when threads is 0.  Returns once all instances are done.
+        void run(unsigned threads = 0);
+
+    // Statistics from the last run
+    public:
+        uint64_t steals;                        // Instances taken from another worker's queue
+        std::vector<uint64_t> workerCycles;     // Cycles each worker ran
+
+    private:
+        struct Instance {
+            Core6502::CPU * cpu;
+            uint64_t cycles;                    // Cycles left to run
+            int32_t stopPC;
+            FleetDoneCallback done;
+            void * context;
+        };
+
+        struct Worker;
+
+        std::vector<Instance> instances;
+
+        void work(std::vector<Worker *> & workers, size_t self);
+    };
+
+}
+
+#endif /* Core6502Fleet_hpp */
@@ -0,0 +1,89 @@
+//
+//  Core6502JIT.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+#ifndef Core6502JIT_hpp
+#define Core6502JIT_hpp
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "Core6502Bus.hpp"
+
+namespace Core6502 {
+
+    class CPU;
+
+    // x86-64 recompiler behind Interpreter::JIT, only built into the Core6502JIT library.
+    //
+    // Translates traces of 6502 code starting at a PC into host code.  A trace follows
+    // straight-line code and absolute JMPs.  Branches back into the trace become host
+    // loops.  A, X, Y and P live in host registers for the whole trace, and N/Z are
+    // computed lazily from the last result.  Loads, stores, ALU, compare, transfer, flag
+    // and branch instructions are emitted inline.  Everything else calls the same
+    // operation templates the interpreters use, so behaviour matches them exactly.
+    //
+    // Pages holding translated code get a bus write trap, like the block cache.  A write
+    // drops every trace on the page.  Code on I/O pages, or on pages rewritten too often,
+    // runs on the interpreter one instruction at a time, as does everything while the D
+    // flag is set.  Code written straight into CPU::mem bypasses the trap; call flush()
+    // afterwards.
+    //
+    // The code arena is never writable and executable at once.  Where executable memory
+    // can't be had, available() is false and the CPU runs the switch core instead.
+    class JIT {
+
+    // Constructors/Destructors
+    public:
+        JIT(Core6502::CPU & cpu);
+        ~JIT();
+
+    // Execution
+    public:
+        // Runs until cycles are used or PC reaches stopPC (-1 for none) at an instruction
+        // boundary.  Returns cycles used, same contract as the interpreters.
+        uint32_t run(uint32_t cycles, int32_t stopPC);
+
+        void flush();                   // Drops every translation
+        bool available() const;         // False when no executable memory could be mapped
+
+        // Set whenever a translated code page is written
+        bool invalidated;
+
+    // Statistics
+    public:
+        uint64_t translations;          // Traces compiled
+        uint64_t entries;               // Calls into translated code
+
+    // Internals
+    public:
+        typedef int32_t (*Trace)(Core6502::CPU * cpu, int32_t budget, int32_t stopPC);
+
+        static const int MaxTraceLength = 64;       // Instructions per trace
+        static const int MaxTracePages = 4;         // Pages one trace may read code from
+        static const size_t CodeSize = 4 << 20;     // Bytes of host code before a full flush
+
+    private:
+        Core6502::CPU & cpu;
+        Core6502::Bus & bus;
+        int trap;
+        uint32_t mapGeneration;
+
+        uint8_t * code;                 // Arena, read/execute except while compile() writes it
+        size_t codeUsed;
+
+        Trace * traces;                 // Indexed by start PC, NULL when not translated
+        std::vector<uint16_t> pageTraces[0x100];    // Trace starts reading code from each page
+        uint16_t pageRewrites[0x100];
+
+        Trace lookup(uint16_t pc);
+        Trace compile(uint16_t pc);
+        bool cacheable(uint8_t page) const;
+        static void codeWritten(void * context, uint16_t addr, uint8_t value);
+    };
+
+}
+
+#endif /* Core6502JIT_hpp */
@@ -0,0 +1,397 @@
+//
+//  Core6502OpcodeTable.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+// Default opcode table shared by CPU::setupInstructionMap() and the switch interpreter.
+// Every opcode is listed in order so the table can also be expanded into a 256 entry
+// array.  Define CORE6502_OPCODE(opCode, cycles, operation, addressing) before including.
+//
+// Addressing:
+//  IMP - Implied           IMM - Immediate         ACC - Accumulator
+//  ZPG - Zero Page         ZPX - Zero Page,X       ZPY - Zero Page,Y
+//  ABS - Absolute          ABX - Absolute,X        ABY - Absolute,Y
+//  IZX - (Indirect,X)      IZY - (Indirect),Y      IND - Indirect
+//  REL - Relative
+//
+// No include guard on purpose.
+
+// Addressing tokens as addressing functions, for expanding the table into Instructions
+#ifndef CORE6502_ADDRESSING_IMP
+#define CORE6502_ADDRESSING_IMP NULL
+#define CORE6502_ADDRESSING_IMM Core6502::CPU::immediate
+#define CORE6502_ADDRESSING_ACC Core6502::CPU::accumlatorAddr
+#define CORE6502_ADDRESSING_ZPG Core6502::CPU::zeroPageAddr
+#define CORE6502_ADDRESSING_ZPX Core6502::CPU::zeroPageXAddr
+#define CORE6502_ADDRESSING_ZPY Core6502::CPU::zeroPageYAddr
+#define CORE6502_ADDRESSING_ABS Core6502::CPU::absoluteAddr
+#define CORE6502_ADDRESSING_ABX Core6502::CPU::absoluteXAddr
+#define CORE6502_ADDRESSING_ABY Core6502::CPU::absoluteYAddr
+#define CORE6502_ADDRESSING_IZX Core6502::CPU::indirectXAddr
+#define CORE6502_ADDRESSING_IZY Core6502::CPU::indirectYAddr
+#define CORE6502_ADDRESSING_IND Core6502::CPU::indirectAddr
+#define CORE6502_ADDRESSING_REL Core6502::CPU::relativeAddr
+#endif
+
+// Addressing tokens as compile-time addressing modes, for expanding the table into templates
+#ifndef CORE6502_ADDRESSING_MODE_IMP
+#define CORE6502_ADDRESSING_MODE_IMP Core6502::Addressing::Implied
+#define CORE6502_ADDRESSING_MODE_IMM Core6502::Addressing::Immediate
+#define CORE6502_ADDRESSING_MODE_ACC Core6502::Addressing::Accumulator
+#define CORE6502_ADDRESSING_MODE_ZPG Core6502::Addressing::ZeroPage
+#define CORE6502_ADDRESSING_MODE_ZPX Core6502::Addressing::ZeroPageX
+#define CORE6502_ADDRESSING_MODE_ZPY Core6502::Addressing::ZeroPageY
+#define CORE6502_ADDRESSING_MODE_ABS Core6502::Addressing::Absolute
+#define CORE6502_ADDRESSING_MODE_ABX Core6502::Addressing::AbsoluteX
+#define CORE6502_ADDRESSING_MODE_ABY Core6502::Addressing::AbsoluteY
+#define CORE6502_ADDRESSING_MODE_IZX Core6502::Addressing::IndirectX
+#define CORE6502_ADDRESSING_MODE_IZY Core6502::Addressing::IndirectY
+#define CORE6502_ADDRESSING_MODE_IND Core6502::Addressing::Indirect
+#define CORE6502_ADDRESSING_MODE_REL Core6502::Addressing::Relative
+#endif
+
+// Addressing tokens as predecoded addressing modes, for the block cache
+#ifndef CORE6502_ADDRESSING_DECODED_IMP
+#define CORE6502_ADDRESSING_DECODED_IMP Core6502::Addressing::DecodedImplied
+#define CORE6502_ADDRESSING_DECODED_IMM Core6502::Addressing::DecodedImmediate
+#define CORE6502_ADDRESSING_DECODED_ACC Core6502::Addressing::DecodedAccumulator
+#define CORE6502_ADDRESSING_DECODED_ZPG Core6502::Addressing::DecodedZeroPage
+#define CORE6502_ADDRESSING_DECODED_ZPX Core6502::Addressing::DecodedZeroPageX
+#define CORE6502_ADDRESSING_DECODED_ZPY Core6502::Addressing::DecodedZeroPageY
+#define CORE6502_ADDRESSING_DECODED_ABS Core6502::Addressing::DecodedAbsolute
+#define CORE6502_ADDRESSING_DECODED_ABX Core6502::Addressing::DecodedAbsoluteX
+#define CORE6502_ADDRESSING_DECODED_ABY Core6502::Addressing::DecodedAbsoluteY
+#define CORE6502_ADDRESSING_DECODED_IZX Core6502::Addressing::DecodedIndirectX
+#define CORE6502_ADDRESSING_DECODED_IZY Core6502::Addressing::DecodedIndirectY
+#define CORE6502_ADDRESSING_DECODED_IND Core6502::Addressing::DecodedIndirect
+#define CORE6502_ADDRESSING_DECODED_REL Core6502::Addressing::DecodedRelative
+#endif
+
+// Addressing tokens as instruction length in bytes, opcode included
+#ifndef CORE6502_ADDRESSING_LENGTH_IMP
+#define CORE6502_ADDRESSING_LENGTH_IMP 1
+#define CORE6502_ADDRESSING_LENGTH_IMM 2
+#define CORE6502_ADDRESSING_LENGTH_ACC 1
+#define CORE6502_ADDRESSING_LENGTH_ZPG 2
+#define CORE6502_ADDRESSING_LENGTH_ZPX 2
+#define CORE6502_ADDRESSING_LENGTH_ZPY 2
+#define CORE6502_ADDRESSING_LENGTH_ABS 3
+#define CORE6502_ADDRESSING_LENGTH_ABX 3
+#define CORE6502_ADDRESSING_LENGTH_ABY 3
+#define CORE6502_ADDRESSING_LENGTH_IZX 2
+#define CORE6502_ADDRESSING_LENGTH_IZY 2
+#define CORE6502_ADDRESSING_LENGTH_IND 3
+#define CORE6502_ADDRESSING_LENGTH_REL 2
+#endif
+
+// Addressing tokens that can leave CPU::extraCycles set: indexed modes that cross a page on a
+// read and branches
+#ifndef CORE6502_ADDRESSING_VARIABLE_IMP
+#define CORE6502_ADDRESSING_VARIABLE_IMP 0
+#define CORE6502_ADDRESSING_VARIABLE_IMM 0
+#define CORE6502_ADDRESSING_VARIABLE_ACC 0
+#define CORE6502_ADDRESSING_VARIABLE_ZPG 0
+#define CORE6502_ADDRESSING_VARIABLE_ZPX 0
+#define CORE6502_ADDRESSING_VARIABLE_ZPY 0
+#define CORE6502_ADDRESSING_VARIABLE_ABS 0
+#define CORE6502_ADDRESSING_VARIABLE_ABX 1
+#define CORE6502_ADDRESSING_VARIABLE_ABY 1
+#define CORE6502_ADDRESSING_VARIABLE_IZX 0
+#define CORE6502_ADDRESSING_VARIABLE_IZY 1
+#define CORE6502_ADDRESSING_VARIABLE_IND 0
+#define CORE6502_ADDRESSING_VARIABLE_REL 1
+#endif
+
+#ifndef CORE6502_OPCODE
+#error "Define CORE6502_OPCODE before including Core6502OpcodeTable.hpp"
+#endif
+
+// 0x00 - 0x0F
+CORE6502_OPCODE(0x00, 7, BRK, IMP)
+CORE6502_OPCODE(0x01, 6, ORA, IZX)
+CORE6502_OPCODE(0x02, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x03, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x04, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x05, 3, ORA, ZPG)
+CORE6502_OPCODE(0x06, 5, ASL, ZPG)
+CORE6502_OPCODE(0x07, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x08, 3, PHP, IMP)
+CORE6502_OPCODE(0x09, 2, ORA, IMM)
+CORE6502_OPCODE(0x0A, 2, ASL, ACC)
+CORE6502_OPCODE(0x0B, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x0C, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x0D, 4, ORA, ABS)
+CORE6502_OPCODE(0x0E, 6, ASL, ABS)
+CORE6502_OPCODE(0x0F, 2, NOP, IMP)    // Undocumented
+
+// 0x10 - 0x1F
+CORE6502_OPCODE(0x10, 2, BPL, REL)
+CORE6502_OPCODE(0x11, 5, ORA, IZY)
+CORE6502_OPCODE(0x12, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x13, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x14, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x15, 4, ORA, ZPX)
+CORE6502_OPCODE(0x16, 6, ASL, ZPX)
+CORE6502_OPCODE(0x17, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x18, 2, CLC, IMP)
+CORE6502_OPCODE(0x19, 4, ORA, ABY)
+CORE6502_OPCODE(0x1A, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x1B, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x1C, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x1D, 4, ORA, ABX)
+CORE6502_OPCODE(0x1E, 7, ASL, ABX)
+CORE6502_OPCODE(0x1F, 2, NOP, IMP)    // Undocumented
+
+// 0x20 - 0x2F
+CORE6502_OPCODE(0x20, 6, JSR, ABS)
+CORE6502_OPCODE(0x21, 6, AND, IZX)
+CORE6502_OPCODE(0x22, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x23, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x24, 3, BIT, ZPG)
+CORE6502_OPCODE(0x25, 3, AND, ZPG)
+CORE6502_OPCODE(0x26, 5, ROL, ZPG)
+CORE6502_OPCODE(0x27, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x28, 4, PLP, IMP)
+CORE6502_OPCODE(0x29, 2, AND, IMM)
+CORE6502_OPCODE(0x2A, 2, ROL, ACC)
+CORE6502_OPCODE(0x2B, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x2C, 4, BIT, ABS)
+CORE6502_OPCODE(0x2D, 4, AND, ABS)
+CORE6502_OPCODE(0x2E, 6, ROL, ABS)
+CORE6502_OPCODE(0x2F, 2, NOP, IMP)    // Undocumented
+
+// 0x30 - 0x3F
+CORE6502_OPCODE(0x30, 2, BMI, REL)
+CORE6502_OPCODE(0x31, 5, AND, IZY)
+CORE6502_OPCODE(0x32, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x33, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x34, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x35, 4, AND, ZPX)
+CORE6502_OPCODE(0x36, 6, ROL, ZPX)
+CORE6502_OPCODE(0x37, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x38, 2, SEC, IMP)
+CORE6502_OPCODE(0x39, 4, AND, ABY)
+CORE6502_OPCODE(0x3A, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x3B, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x3C, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x3D, 4, AND, ABX)
+CORE6502_OPCODE(0x3E, 7, ROL, ABX)
+CORE6502_OPCODE(0x3F, 2, NOP, IMP)    // Undocumented
+
+// 0x40 - 0x4F
+CORE6502_OPCODE(0x40, 6, RTI, IMP)
+CORE6502_OPCODE(0x41, 6, EOR, IZX)
+CORE6502_OPCODE(0x42, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x43, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x44, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x45, 3, EOR, ZPG)
+CORE6502_OPCODE(0x46, 5, LSR, ZPG)
+CORE6502_OPCODE(0x47, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x48, 3, PHA, IMP)
+CORE6502_OPCODE(0x49, 2, EOR, IMM)
+CORE6502_OPCODE(0x4A, 2, LSR, ACC)
+CORE6502_OPCODE(0x4B, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x4C, 3, JMP, ABS)
+CORE6502_OPCODE(0x4D, 4, EOR, ABS)
+CORE6502_OPCODE(0x4E, 6, LSR, ABS)
+CORE6502_OPCODE(0x4F, 2, NOP, IMP)    // Undocumented
+
+// 0x50 - 0x5F
+CORE6502_OPCODE(0x50, 2, BVC, REL)
+CORE6502_OPCODE(0x51, 5, EOR, IZY)
+CORE6502_OPCODE(0x52, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x53, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x54, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x55, 4, EOR, ZPX)
+CORE6502_OPCODE(0x56, 6, LSR, ZPX)
+CORE6502_OPCODE(0x57, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x58, 2, CLI, IMP)
+CORE6502_OPCODE(0x59, 4, EOR, ABY)
+CORE6502_OPCODE(0x5A, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x5B, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x5C, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x5D, 4, EOR, ABX)
+CORE6502_OPCODE(0x5E, 7, LSR, ABX)
+CORE6502_OPCODE(0x5F, 2, NOP, IMP)    // Undocumented
+
+// 0x60 - 0x6F
+CORE6502_OPCODE(0x60, 6, RTS, IMP)
+CORE6502_OPCODE(0x61, 6, ADC, IZX)
+CORE6502_OPCODE(0x62, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x63, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x64, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x65, 3, ADC, ZPG)
+CORE6502_OPCODE(0x66, 5, ROR, ZPG)
+CORE6502_OPCODE(0x67, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x68, 4, PLA, IMP)
+CORE6502_OPCODE(0x69, 2, ADC, IMM)
+CORE6502_OPCODE(0x6A, 2, ROR, ACC)
+CORE6502_OPCODE(0x6B, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x6C, 5, JMP, IND)
+CORE6502_OPCODE(0x6D, 4, ADC, ABS)
+CORE6502_OPCODE(0x6E, 6, ROR, ABS)
+CORE6502_OPCODE(0x6F, 2, NOP, IMP)    // Undocumented
+
+// 0x70 - 0x7F
+CORE6502_OPCODE(0x70, 2, BVS, REL)
+CORE6502_OPCODE(0x71, 5, ADC, IZY)
+CORE6502_OPCODE(0x72, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x73, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x74, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x75, 4, ADC, ZPX)
+CORE6502_OPCODE(0x76, 6, ROR, ZPX)
+CORE6502_OPCODE(0x77, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x78, 2, SEI, IMP)
+CORE6502_OPCODE(0x79, 4, ADC, ABY)
+CORE6502_OPCODE(0x7A, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x7B, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x7C, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x7D, 4, ADC, ABX)
+CORE6502_OPCODE(0x7E, 7, ROR, ABX)
+CORE6502_OPCODE(0x7F, 2, NOP, IMP)    // Undocumented
+
+// 0x80 - 0x8F
+CORE6502_OPCODE(0x80, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x81, 6, STA, IZX)
+CORE6502_OPCODE(0x82, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x83, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x84, 3, STY, ZPG)
+CORE6502_OPCODE(0x85, 3, STA, ZPG)
+CORE6502_OPCODE(0x86, 3, STX, ZPG)
+CORE6502_OPCODE(0x87, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x88, 2, DEY, IMP)
+CORE6502_OPCODE(0x89, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x8A, 2, TXA, IMP)
+CORE6502_OPCODE(0x8B, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x8C, 4, STY, ABS)
+CORE6502_OPCODE(0x8D, 4, STA, ABS)
+CORE6502_OPCODE(0x8E, 4, STX, ABS)
+CORE6502_OPCODE(0x8F, 2, NOP, IMP)    // Undocumented
+
+// 0x90 - 0x9F
+CORE6502_OPCODE(0x90, 2, BCC, REL)
+CORE6502_OPCODE(0x91, 6, STA, IZY)
+CORE6502_OPCODE(0x92, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x93, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x94, 4, STY, ZPX)
+CORE6502_OPCODE(0x95, 4, STA, ZPX)
+CORE6502_OPCODE(0x96, 4, STX, ZPY)
+CORE6502_OPCODE(0x97, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x98, 2, TYA, IMP)
+CORE6502_OPCODE(0x99, 5, STA, ABY)
+CORE6502_OPCODE(0x9A, 2, TXS, IMP)
+CORE6502_OPCODE(0x9B, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x9C, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x9D, 5, STA, ABX)
+CORE6502_OPCODE(0x9E, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0x9F, 2, NOP, IMP)    // Undocumented
+
+// 0xA0 - 0xAF
+CORE6502_OPCODE(0xA0, 2, LDY, IMM)
+CORE6502_OPCODE(0xA1, 6, LDA, IZX)
+CORE6502_OPCODE(0xA2, 2, LDX, IMM)
+CORE6502_OPCODE(0xA3, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xA4, 3, LDY, ZPG)
+CORE6502_OPCODE(0xA5, 3, LDA, ZPG)
+CORE6502_OPCODE(0xA6, 3, LDX, ZPG)
+CORE6502_OPCODE(0xA7, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xA8, 2, TAY, IMP)
+CORE6502_OPCODE(0xA9, 2, LDA, IMM)
+CORE6502_OPCODE(0xAA, 2, TAX, IMP)
+CORE6502_OPCODE(0xAB, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xAC, 4, LDY, ABS)
+CORE6502_OPCODE(0xAD, 4, LDA, ABS)
+CORE6502_OPCODE(0xAE, 4, LDX, ABS)
+CORE6502_OPCODE(0xAF, 2, NOP, IMP)    // Undocumented
+
+// 0xB0 - 0xBF
+CORE6502_OPCODE(0xB0, 2, BCS, REL)
+CORE6502_OPCODE(0xB1, 5, LDA, IZY)
+CORE6502_OPCODE(0xB2, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xB3, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xB4, 4, LDY, ZPX)
+CORE6502_OPCODE(0xB5, 4, LDA, ZPX)
+CORE6502_OPCODE(0xB6, 4, LDX, ZPY)
+CORE6502_OPCODE(0xB7, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xB8, 2, CLV, IMP)
+CORE6502_OPCODE(0xB9, 4, LDA, ABY)
+CORE6502_OPCODE(0xBA, 2, TSX, IMP)
+CORE6502_OPCODE(0xBB, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xBC, 4, LDY, ABX)
+CORE6502_OPCODE(0xBD, 4, LDA, ABX)
+CORE6502_OPCODE(0xBE, 4, LDX, ABY)
+CORE6502_OPCODE(0xBF, 2, NOP, IMP)    // Undocumented
+
+// 0xC0 - 0xCF
+CORE6502_OPCODE(0xC0, 2, CPY, IMM)
+CORE6502_OPCODE(0xC1, 6, CMP, IZX)
+CORE6502_OPCODE(0xC2, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xC3, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xC4, 3, CPY, ZPG)
+CORE6502_OPCODE(0xC5, 3, CMP, ZPG)
+CORE6502_OPCODE(0xC6, 5, DEC, ZPG)
+CORE6502_OPCODE(0xC7, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xC8, 2, INY, IMP)
+CORE6502_OPCODE(0xC9, 2, CMP, IMM)
+CORE6502_OPCODE(0xCA, 2, DEX, IMP)
+CORE6502_OPCODE(0xCB, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xCC, 4, CPY, ABS)
+CORE6502_OPCODE(0xCD, 4, CMP, ABS)
+CORE6502_OPCODE(0xCE, 6, DEC, ABS)
+CORE6502_OPCODE(0xCF, 2, NOP, IMP)    // Undocumented
+
+// 0xD0 - 0xDF
+CORE6502_OPCODE(0xD0, 2, BNE, REL)
+CORE6502_OPCODE(0xD1, 5, CMP, IZY)
+CORE6502_OPCODE(0xD2, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xD3, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xD4, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xD5, 4, CMP, ZPX)
+CORE6502_OPCODE(0xD6, 6, DEC, ZPX)
+CORE6502_OPCODE(0xD7, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xD8, 2, CLD, IMP)
+CORE6502_OPCODE(0xD9, 4, CMP, ABY)
+CORE6502_OPCODE(0xDA, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xDB, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xDC, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xDD, 4, CMP, ABX)
+CORE6502_OPCODE(0xDE, 7, DEC, ABX)
+CORE6502_OPCODE(0xDF, 2, NOP, IMP)    // Undocumented
+
+// 0xE0 - 0xEF
+CORE6502_OPCODE(0xE0, 2, CPX, IMM)
+CORE6502_OPCODE(0xE1, 6, SBC, IZX)
+CORE6502_OPCODE(0xE2, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xE3, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xE4, 3, CPX, ZPG)
+CORE6502_OPCODE(0xE5, 3, SBC, ZPG)
+CORE6502_OPCODE(0xE6, 5, INC, ZPG)
+CORE6502_OPCODE(0xE7, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xE8, 2, INX, IMP)
+CORE6502_OPCODE(0xE9, 2, SBC, IMM)
+CORE6502_OPCODE(0xEA, 2, NOP, IMP)
+CORE6502_OPCODE(0xEB, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xEC, 4, CPX, ABS)
+CORE6502_OPCODE(0xED, 4, SBC, ABS)
+CORE6502_OPCODE(0xEE, 6, INC, ABS)
+CORE6502_OPCODE(0xEF, 2, NOP, IMP)    // Undocumented
+
+// 0xF0 - 0xFF
+CORE6502_OPCODE(0xF0, 2, BEQ, REL)
+CORE6502_OPCODE(0xF1, 5, SBC, IZY)
+CORE6502_OPCODE(0xF2, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xF3, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xF4, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xF5, 4, SBC, ZPX)
+CORE6502_OPCODE(0xF6, 6, INC, ZPX)
+CORE6502_OPCODE(0xF7, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xF8, 2, SED, IMP)
+CORE6502_OPCODE(0xF9, 4, SBC, ABY)
+CORE6502_OPCODE(0xFA, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xFB, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xFC, 2, NOP, IMP)    // Undocumented
+CORE6502_OPCODE(0xFD, 4, SBC, ABX)
+CORE6502_OPCODE(0xFE, 7, INC, ABX)
+CORE6502_OPCODE(0xFF, 2, NOP, IMP)    // Undocumented
@@ -0,0 +1,711 @@
+//
+//  Core6502OperationTemplates.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+#ifndef Core6502OperationTemplates_hpp
+#define Core6502OperationTemplates_hpp
+
+#include <stdint.h>
+#include "Core6502.hpp"
+#include "Core6502Addressing.hpp"
+#include "Core6502Flags.hpp"
+#include "Core6502Decimal.hpp"
+
+// Compile-time form of every operation.  The addressing mode is a template parameter, so
+// e.g. LDA<Addressing::AbsoluteX>(cpu) compiles to one function with the addressing inlined.
+// The pointer based operations in Core6502Operations.hpp instantiate these with
+// Addressing::Dynamic.  The flag mode is a second parameter (see Core6502Flags.hpp); everything
+// but the switch and cached cores uses Flags::Status.
+
+namespace Core6502 {
+
+    // Default opcode table as one specialized function per opcode.  These and decodedOperations
+    // always update status directly.
+    extern void (* const specializedOperations[0x100])(Core6502::CPU&);
+
+    // Default opcode table with operands predecoded.  PC must already point past the instruction.
+    extern void (* const decodedOperations[0x100])(Core6502::CPU&, uint16_t operand);
+
+    // Load Register Instructions
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void LDA(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Fetch Value and store into accumulator
+        cpu.registers.A = mode.read(cpu);
+
+        // Set Zero & Negative Flags appropriately
+        FlagMode::setNZ(cpu, cpu.registers.A);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void LDX(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Fetch Value and store into X
+        cpu.registers.X = mode.read(cpu);
+
+        // Set Zero & Negative Flags appropriately
+        FlagMode::setNZ(cpu, cpu.registers.X);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void LDY(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Fetch Value and store into Y
+        cpu.registers.Y = mode.read(cpu);
+
+        // Set Zero & Negative Flags appropriately
+        FlagMode::setNZ(cpu, cpu.registers.Y);
+
+    }
+
+    // Store Register Instructions
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void STA(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Fetch address
+        uint16_t addr = mode.address(cpu);
+
+        // Store Accumulator to index
+        cpu.write(addr, cpu.registers.A);
+
+        // Set Zero & Negative Flags appropriately
+        FlagMode::setNZ(cpu, cpu.registers.A);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void STX(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Fetch Zero Page address
+        uint8_t addr = mode.address(cpu);
+
+        // Write X register to RAM
+        cpu.write(addr, cpu.registers.X);
+
+        // Set Zero & Negative Flags appropriately
+        FlagMode::setNZ(cpu, cpu.registers.X);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void STY(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Fetch Zero Page address
+        uint8_t addr = mode.address(cpu);
+
+        // Load value at index into Y
+        // Can directly index memory with fetched addr
+        cpu.registers.Y = cpu.read(addr);
+
+        // Set Zero & Negative Flags appropriately
+        FlagMode::setNZ(cpu, cpu.registers.Y);
+
+    }
+
+    // Transfer Instructions
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void TAX(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Transfer Accumulator to X
+        cpu.registers.X = cpu.registers.A;
+
+        // Set Zero & Negative Flags
+        FlagMode::setNZ(cpu, cpu.registers.X);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void TAY(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Transfer Accumulator to Y
+        cpu.registers.Y = cpu.registers.A;
+
+        // Set Zero & Negative Flags
+        FlagMode::setNZ(cpu, cpu.registers.Y);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void TXA(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Transfer X to Accumulator
+        cpu.registers.A = cpu.registers.X;
+
+        // Set Zero & Negative Flags
+        FlagMode::setNZ(cpu, cpu.registers.A);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void TYA(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Transfer Y to Accumulator
+        cpu.registers.A = cpu.registers.Y;
+
+        // Set Zero & Negative Flags
+        FlagMode::setNZ(cpu, cpu.registers.A);
+
+    }
+
+    // Logic Instructions
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void AND(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Fetch Value AND with Accumulator
+        cpu.registers.A &= mode.read(cpu);
+
+        // Set Zero & Negative Flags appropriately
+        FlagMode::setNZ(cpu, cpu.registers.A);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void ORA(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Fetch Value OR with Accumulator
+        cpu.registers.A |= mode.read(cpu);
+
+        // Set Zero & Negative Flags appropriately
+        FlagMode::setNZ(cpu, cpu.registers.A);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void EOR(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Fetch Value EOR with Accumulator
+        cpu.registers.A ^= mode.read(cpu);
+
+        // Set Zero & Negative Flags appropriately
+        FlagMode::setNZ(cpu, cpu.registers.A);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void BIT(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Fetch Zero Page address
+        uint16_t addr = mode.address(cpu);
+
+        // And value with Accumulator
+        uint8_t fetched = cpu.read(addr);
+        uint8_t val = cpu.registers.A & fetched;
+
+        // Set Zero & Negative Flags appropriately
+        FlagMode::setNZ(cpu, fetched, val);
+        FlagMode::setOverflow(cpu, fetched & 0b01000000);
+
+    }
+
+    // Shift & Rotate
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void ROL(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        uint16_t val;
+        uint16_t addr = 0;
+
+        // Fetch value and address if applicable
+        if (mode.isAccumulator())
+            val = (uint8_t)mode.address(cpu);
+        else {
+            addr = mode.address(cpu);
+            val = (uint8_t)cpu.read(addr);
+        }
+
+        // Capture temp carry flag and shift values
+        val = (val << 1) | FlagMode::carry(cpu);
+
+        // Set status
+        FlagMode::setCarry(cpu, val & 0xFF00);
+        FlagMode::setNZ(cpu, (uint8_t)val);
+
+        if (mode.isAccumulator())
+            cpu.registers.A = (uint8_t)val;
+        else
+            cpu.write(addr, (uint8_t)val);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void ROR(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        uint16_t val;
+        uint16_t addr = 0;
+
+        // Fetch value and address if applicable
+        if (mode.isAccumulator())
+            val = (uint8_t)mode.address(cpu);
+        else {
+            addr = mode.address(cpu);
+            val = (uint8_t)cpu.read(addr);
+        }
+
+        // Capture temp carry flag and shift values
+        bool carry = (bool)(val & 0x1);
+        val = (val >> 1) + (FlagMode::carry(cpu) << 7);
+
+        // Set status
+        FlagMode::setCarry(cpu, carry);
+        FlagMode::setNZ(cpu, (uint8_t)val);
+
+        if (mode.isAccumulator())
+            cpu.registers.A = (uint8_t)val;
+        else
+            cpu.write(addr, (uint8_t)val);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void ASL(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        uint16_t val;
+        uint16_t addr = 0;
+
+        // Fetch value and address if applicable
+        if (mode.isAccumulator())
+            val = (uint8_t)mode.address(cpu);
+        else {
+            addr = mode.address(cpu);
+            val = (uint8_t)cpu.read(addr);
+        }
+
+        // Shift left by 1
+        val = val << 1;
+
+        // Set flags
+        FlagMode::setCarry(cpu, val & 0xFF00);
+        FlagMode::setNZ(cpu, (bool)val & 0xF0, (uint8_t)val);
+
+        // Write back
+        if (mode.isAccumulator())
+            cpu.registers.A = (uint8_t)val;
+        else
+            cpu.write(addr, (uint8_t)val);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void LSR(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        uint16_t val;
+        uint16_t addr = 0;
+
+        // Fetch value and address if applicable
+        if (mode.isAccumulator())
+            val = (uint8_t)mode.address(cpu);
+        else {
+            addr = mode.address(cpu);
+            val = (uint8_t)cpu.read(addr);
+        }
+
+        // Shift right by 1
+        FlagMode::setCarry(cpu, val & 0x1);
+        val = val >> 1;
+
+        // Set flags
+        FlagMode::setNZ(cpu, (uint8_t)val);
+
+        // Write back
+        if (mode.isAccumulator())
+            cpu.registers.A = (uint8_t)val;
+        else
+            cpu.write(addr, (uint8_t)val);
+
+    }
+
+    // Compare Instructions
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void CMP(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Fetch value
+        uint8_t fetched = mode.read(cpu);
+
+        // Compare values and set flags
+        FlagMode::setFlags(cpu, Core6502::ALU::compare(cpu.registers.A, fetched), Core6502::ALU::CompareFlags);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void CPX(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Fetch value
+        uint8_t fetched = mode.read(cpu);
+
+        // Compare values and set flags
+        FlagMode::setFlags(cpu, Core6502::ALU::compare(cpu.registers.X, fetched), Core6502::ALU::CompareFlags);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void CPY(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Fetch value
+        uint8_t fetched = mode.read(cpu);
+
+        // Compare values and set flags
+        FlagMode::setFlags(cpu, Core6502::ALU::compare(cpu.registers.Y, fetched), Core6502::ALU::CompareFlags);
+
+    }
+
+    // Increment Instructions
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void INC(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Get address
+        uint16_t addr = mode.address(cpu);
+
+        // Increment value at address
+        uint8_t val = cpu.read(addr) + 1;
+        cpu.write(addr, val);
+
+        // Set flags
+        FlagMode::setNZ(cpu, val);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void INX(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Increment X register
+        cpu.registers.X++;
+
+        // Set flags
+        FlagMode::setNZ(cpu, cpu.registers.X);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void INY(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Increment Y register
+        cpu.registers.Y++;
+
+        // Set flags
+        FlagMode::setNZ(cpu, cpu.registers.Y);
+
+    }
+
+    // Decrement Instructions
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void DEC(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Get address
+        uint16_t addr = mode.address(cpu);
+
+        // Decrement value at address
+        uint8_t val = cpu.read(addr) - 1;
+        cpu.write(addr, val);
+
+        // Set flags
+        FlagMode::setNZ(cpu, val);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void DEX(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Decrement X register
+        cpu.registers.X--;
+
+        // Set flags
+        FlagMode::setNZ(cpu, cpu.registers.X);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void DEY(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Decrement Y register
+        cpu.registers.Y--;
+
+        // Set flags
+        FlagMode::setNZ(cpu, cpu.registers.Y);
+
+    }
+
+    // Arithmatic Instructions
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void ADC(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Fetch value
+        uint8_t val = mode.read(cpu);
+
+        // Perform calculation, decimal mode comes ready made (see Core6502Decimal.hpp)
+        uint16_t entry;
+        if (cpu.status.bitfield.DecimalMode)
+            entry = Core6502::Decimal::adc[Core6502::Decimal::index(FlagMode::carry(cpu), cpu.registers.A, val)];
+        else
+            entry = Core6502::ALU::adc(cpu.registers.A, val, FlagMode::carry(cpu));
+
+        // Set flags and update accumulator
+        FlagMode::setFlags(cpu, entry >> 8, Core6502::ALU::ArithmeticFlags);
+        cpu.registers.A = (uint8_t)entry;
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void SBC(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Fetch value
+        uint8_t val = mode.read(cpu);
+
+        // Perform calculation.  Decimal mode sets flags the same, only the result differs.
+        uint8_t borrow = FlagMode::carry(cpu);
+        uint16_t entry = Core6502::ALU::sbc(cpu.registers.A, val, borrow);
+        uint8_t result = (uint8_t)entry;
+        if (cpu.status.bitfield.DecimalMode)
+            result = Core6502::Decimal::sbc[Core6502::Decimal::index(borrow, cpu.registers.A, val)];
+
+        // Set flags and update accumulator
+        FlagMode::setFlags(cpu, entry >> 8, Core6502::ALU::ArithmeticFlags);
+        cpu.registers.A = result;
+
+    }
+
+    // JMP Instructions
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void JMP(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Get address and set program counter to it
+        cpu.registers.PC = mode.address(cpu);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void JSR(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Get absolute address
+        uint16_t addr = mode.address(cpu);
+
+        // Current PC onto stack
+        cpu.write(0x100 + cpu.registers.SP, cpu.registers.PC >> 8);
+        cpu.registers.SP--;
+        cpu.write(0x100 + cpu.registers.SP, cpu.registers.PC & 0xFF);
+        cpu.registers.SP--;
+
+        // Set PC to fetched address
+        cpu.registers.PC = addr;
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void RTS(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Pop return address off stack
+        uint16_t addr = (cpu.read(0x100 + cpu.registers.SP)) << 8;
+        cpu.registers.SP++;
+
+        addr += cpu.read(0x100 + cpu.registers.SP) & 0xFF;
+        cpu.registers.SP++;
+
+        // Set PC to addr
+        cpu.registers.PC = addr;
+
+    }
+
+    // Branch Instructions
+
+    // Takes a branch to addr when taken: a cycle more, and another when addr is on a different
+    // page than the following instruction.  No branches of its own on the host.
+    inline void branchIf(Core6502::CPU& cpu, bool taken, uint16_t addr) {
+        uint8_t crossed = ((cpu.registers.PC ^ addr) >> 8) != 0;
+        cpu.extraCycles = taken * (1 + crossed);
+        cpu.registers.PC = taken ? addr : cpu.registers.PC;
+    }
+
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void BCC(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+        // Fetch Branch Address
+        uint16_t addr = mode.address(cpu);
+
+        branchIf(cpu, !FlagMode::carry(cpu), addr);
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void BCS(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+        // Fetch Branch Address
+        uint16_t addr = mode.address(cpu);
+
+        branchIf(cpu, FlagMode::carry(cpu), addr);
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void BEQ(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+        // Fetch Branch Address
+        uint16_t addr = mode.address(cpu);
+
+        branchIf(cpu, FlagMode::zero(cpu), addr);
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void BMI(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+        // Fetch Branch Address
+        uint16_t addr = mode.address(cpu);
+
+        branchIf(cpu, FlagMode::negative(cpu), addr);
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void BNE(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+        // Fetch Branch Address
+        uint16_t addr = mode.address(cpu);
+
+        branchIf(cpu, !FlagMode::zero(cpu), addr);
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void BPL(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+        // Fetch Branch Address
+        uint16_t addr = mode.address(cpu);
+
+        branchIf(cpu, !FlagMode::negative(cpu), addr);
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void BVC(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+        // Fetch Branch Address
+        uint16_t addr = mode.address(cpu);
+
+        branchIf(cpu, !FlagMode::overflow(cpu), addr);
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void BVS(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+        // Fetch Branch Address
+        uint16_t addr = mode.address(cpu);
+
+        branchIf(cpu, FlagMode::overflow(cpu), addr);
+    }
+
+    // Status Flag Instructions
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void CLC(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+        // Clear Carry flag
+        FlagMode::setCarry(cpu, false);
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void CLD(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+        // Clear Decimal flag
+        cpu.status.bitfield.DecimalMode = 0;
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void CLI(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+        // Clear Interrupt Disable flag
+        cpu.status.bitfield.InterruptDisable = 0;
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void CLV(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+        // Clear Overflow flag
+        FlagMode::setOverflow(cpu, false);
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void SEC(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+        // Set Carry flag
+        FlagMode::setCarry(cpu, true);
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void SED(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+        // Set Decimal flag
+        cpu.status.bitfield.DecimalMode = 1;
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void SEI(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+        // Set Interrupt Disable flag
+        cpu.status.bitfield.InterruptDisable = 1;
+    }
+
+    // Stack Operations
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void TSX(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Copy stack pointer value to register X
+        uint16_t addr  = cpu.registers.SP;
+                 addr += (0x01 << 8);
+        cpu.registers.X = cpu.read(addr);
+
+        // Set Zero & Negative Flags appropriately
+        FlagMode::setNZ(cpu, cpu.registers.X);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void TXS(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Copy register x value to stack pointer addr
+        uint16_t addr  = cpu.registers.SP;
+                 addr += (0x01 << 8);
+        cpu.write(addr, cpu.registers.X);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void PHA(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Write accumulator on stack
+        uint16_t addr  = cpu.registers.SP;
+                 addr += (0x01 << 8);
+        cpu.write(addr, cpu.registers.A);
+
+        // Decrement SP value
+        cpu.registers.SP--;
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void PHP(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Write status on stack
+        uint16_t addr  = cpu.registers.SP;
+                 addr += (0x01 << 8);
+        cpu.write(addr, FlagMode::raw(cpu));
+
+        // Decrement SP value
+        cpu.registers.SP--;
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void PLA(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Increment SP value
+        cpu.registers.SP++;
+
+        // Read accumulator from stack
+        uint16_t addr  = cpu.registers.SP;
+                 addr += (0x01 << 8);
+        cpu.registers.A = cpu.read(addr);
+
+        // Set Zero & Negative Flags appropriately
+        FlagMode::setNZ(cpu, cpu.registers.A);
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void PLP(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Increment SP value
+        cpu.registers.SP++;
+
+        // Read status from stack
+        uint16_t addr  = cpu.registers.SP;
+                 addr += (0x01 << 8);
+
+        FlagMode::setRaw(cpu, cpu.read(addr));
+
+    }
+
+    // Interrupt/Break
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void BRK(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Push PC onto stack
+        cpu.write(cpu.registers.SP, (uint8_t)(cpu.registers.PC >> 8));
+        cpu.registers.SP--;
+        cpu.write(cpu.registers.SP, (uint8_t)(cpu.registers.PC & 0xFF));
+        cpu.registers.SP--;
+
+        // Push cpu status onto stack
+        cpu.write(cpu.registers.SP, FlagMode::raw(cpu));
+        cpu.registers.SP--;
+
+        // Set PC to IRQ vector
+        cpu.registers.PC =  cpu.read(0xFFFF);
+        cpu.registers.PC |= cpu.read(0xFFFE) << 8;
+
+        // Set break status
+        cpu.status.bitfield.BreakCommand = 0x1;
+
+    }
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void RTI(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+
+        // Pop status from stack
+        FlagMode::setRaw(cpu, cpu.read(cpu.registers.SP));
+        cpu.registers.SP++;
+
+        // Pop PC from stack
+        cpu.registers.PC = cpu.read(cpu.registers.SP);
+        cpu.registers.SP++;
+        cpu.registers.PC |= cpu.read(cpu.registers.SP) << 8;
+        cpu.registers.SP++;
+
+    }
+
+    template <class AddrMode, class FlagMode = Core6502::Flags::Status>
+    inline void NOP(Core6502::CPU& cpu, AddrMode mode = AddrMode()) {
+        // Do nothing...
+    }
+
+}
+
+#endif /* Core6502OperationTemplates_hpp */
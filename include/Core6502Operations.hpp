@@ -14,8 +14,8 @@ namespace Core6502 {
     
     class CPU;
 
-    // Operation struct
-    struct Instruction {
+    // Operation struct.  Padded to 32 bytes so no table entry straddles a cache line
+    struct alignas(32) Instruction {
         uint8_t opCode;
         uint8_t cycles;
         void (*instructionFunction)(Core6502::CPU&, Core6502::Instruction&);
@@ -0,0 +1,140 @@
+//
+//  Core6502Profiler.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+#ifndef Core6502Profiler_hpp
+#define Core6502Profiler_hpp
+
+#include <stdint.h>
+#include <stddef.h>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+#include "Core6502.hpp"
+
+namespace Core6502 {
+
+    // Counts where guest time goes.  Built with CORE6502_PROFILE, every core reports each
+    // instruction to CPU::profiler when one is attached, and the profiler counts executions
+    // and cycles per opcode, per PC, and per guest call stack.  Without CORE6502_PROFILE the
+    // hooks compile to nothing.  The JIT runs on the switch core while a profiler is attached.
+    //
+    // An instruction's cycles are the distance to the start of the next one, so they are only
+    // known once the next instruction starts.  Call finish() before reading the counts to
+    // account for the last one.
+    //
+    // Call stacks follow JSR and BRK into the code they land on, and RTS and RTI back out to
+    // whichever caller the stack pointer has returned to.  Interrupts taken through irq() and
+    // nmi() are counted as part of the code they interrupted.
+    class Profiler {
+
+    // Constructors/Destructors
+    public:
+        Profiler();
+        ~Profiler();
+
+    // Counts
+    public:
+        struct Counts {
+            uint64_t executions;
+            uint64_t cycles;
+        };
+
+        Counts opcodes[0x100];      // Indexed by opcode, like CPU::instructions
+        Counts * addresses;         // 0x10000 entries, indexed by PC
+
+        uint64_t instructions() const;  // Executions across all opcodes
+        uint64_t cycles() const;        // Cycles across all opcodes
+
+        void finish(const Core6502::CPU & cpu);     // Counts the cycles of the last instruction
+        void clear();
+
+        // Called by the cores with the cycle count the instruction at PC starts on
+        inline void instruction(const Core6502::CPU & cpu, uint64_t cycle);
+
+        uint64_t base;              // Cycle count the running core's elapsed count starts from
+
+    // Reports
+    public:
+        // Opcodes then addresses by cycles, highest first, skipping anything never executed
+        void writeFlat(std::ostream & out) const;
+
+        // One line per guest call stack with cycles spent in its innermost function, such as
+        // "$8000;$9000;$9100 1234", the folded format flamegraph.pl reads.  Functions are named
+        // by their entry address; the outermost is wherever profiling started.
+        void writeFolded(std::ostream & out) const;
+
+    private:
+        // Call tree, node 0 is the root
+        struct Node {
+            uint16_t function;
+            uint32_t parent;
+            uint64_t cycles;        // Spent in the function itself
+        };
+        std::vector<Node> nodes;
+        std::unordered_map<uint64_t, uint32_t> children;   // parent << 16 | function to node
+
+        // Calls in progress, with the stack pointer at the call
+        struct Frame {
+            uint32_t node;
+            uint8_t SP;
+        };
+        std::vector<Frame> frames;
+        uint32_t current;
+
+        // Instruction waiting for the next one to learn its cycles
+        bool started;               // Root function named
+        bool pending;
+        uint16_t lastPC;
+        uint8_t lastOpCode;
+        uint8_t lastSP;
+        uint64_t lastCycle;
+
+        void start(uint16_t pc);
+        void settle(uint16_t pc, uint8_t sp, uint64_t cycle);
+
+        Profiler(const Profiler &) = delete;
+        Profiler & operator=(const Profiler &) = delete;
+    };
+
+}
+
+inline void Core6502::Profiler::instruction(const Core6502::CPU & cpu, uint64_t cycle) {
+
+    uint16_t pc = cpu.registers.PC;
+    if (pending) settle(pc, cpu.registers.SP, cycle);
+    else if (!started) start(pc);
+
+    // Opcode straight from the page table so I/O handlers never see the profiler
+    const uint8_t * page = cpu.bus.mapped(pc >> 8);
+    uint8_t opCode = page ? page[pc & 0xFF] : 0;
+
+    opcodes[opCode].executions++;
+    addresses[pc].executions++;
+
+    pending = true;
+    lastPC = pc;
+    lastOpCode = opCode;
+    lastSP = cpu.registers.SP;
+    lastCycle = cycle;
+
+}
+
+// Hooks used by the cores, alongside the trace hooks (see Core6502Trace.hpp)
+#ifdef CORE6502_PROFILE
+#define CORE6502_PROFILE_ATTACHED(profile, cpu) Core6502::Profiler * const profile = (cpu).profiler;
+#define CORE6502_PROFILE_INSTRUCTION(profile, cpu, elapsed) \
+    if (profile) (profile)->instruction((cpu), (profile)->base + (elapsed));
+#define CORE6502_PROFILE_BASE(cpu, cycles) \
+    if ((cpu).profiler) (cpu).profiler->base = (cycles);
+#define CORE6502_PROFILING(cpu) ((cpu).profiler != NULL)
+#else
+#define CORE6502_PROFILE_ATTACHED(profile, cpu)
+#define CORE6502_PROFILE_INSTRUCTION(profile, cpu, elapsed)
+#define CORE6502_PROFILE_BASE(cpu, cycles)
+#define CORE6502_PROFILING(cpu) false
+#endif
+
+#endif /* Core6502Profiler_hpp */
@@ -0,0 +1,141 @@
+//
+//  Core6502Replay.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+#ifndef Core6502Replay_hpp
+#define Core6502Replay_hpp
+
+#include <stdint.h>
+#include <stddef.h>
+#include <iostream>
+#include <deque>
+#include "Core6502.hpp"
+
+namespace Core6502 {
+
+    // Record/replay of a CPU's inputs.  Everything else about a run is deterministic: given the
+    // same start state, the CPU only depends on when irq() and nmi() are called and what reads
+    // of I/O pages return.  Recorder logs those to an append-only stream, and Replayer feeds
+    // them back into a CPU started from the same state, without the devices, reaching the
+    // same registers, memory and cycle count.
+    //
+    // Log format, values little endian:
+    //
+    //  Header      magic "C65R", version, 3 reserved bytes
+    //  Start       save state of the CPU when recording began, optionally against a base
+    //              image (see Core6502SaveState.hpp)
+    //  Events      each a type byte, then a LEB128 varint of cycles since the last event
+    //              Read    address (2), value
+    //              IRQ/NMI nothing more
+    //              End     nothing more, written by Recorder::finish()
+    //
+    // Interrupts are stamped with CPU::totalCycles, so they should be raised between runs or
+    // from scheduler events, where it's exact; replay runs up to that cycle and raises them
+    // again.  totalCycles only moves between runs, so reads are replayed in the order they
+    // were made, checked by address.  The host writing memory or registers behind the CPU's
+    // back isn't an input the log can see.
+    //
+    // Replay needs the same RAM/ROM mapping as the recording.  Pages that were I/O or unmapped
+    // can be left unmapped; their writes still go to whatever handlers are mapped.
+    namespace Replay {
+
+        static const uint8_t Version = 1;
+
+        enum Event : uint8_t {
+            End,
+            Read,
+            IRQ,
+            NMI,
+        };
+
+    }
+
+    class Recorder {
+
+    // Constructors/Destructors
+    public:
+        // Writes the header and cpu's state, against base when it isn't NULL, then logs until
+        // finish() or destruction.  Sets CPU::recorder and the bus's input hook for the duration.
+        Recorder(Core6502::CPU & cpu, std::ostream & out, const uint8_t * base = NULL);
+        ~Recorder();
+
+    // Recording
+    public:
+        void interrupt(Core6502::Replay::Event event);      // Called by CPU::irq() and nmi()
+        void finish();                                      // Writes End and detaches
+        bool good() const;                                  // False once the stream failed
+
+    // Statistics
+    public:
+        uint64_t events;            // Reads and interrupts logged
+
+    private:
+        Core6502::CPU & cpu;
+        std::ostream & out;
+        uint64_t lastCycle;
+        bool finished;
+
+        void event(Core6502::Replay::Event event);
+        static uint8_t input(void * context, uint16_t addr, const Core6502::Bus::Handler & handler);
+
+        Recorder(const Recorder &) = delete;
+        Recorder & operator=(const Recorder &) = delete;
+    };
+
+    class Replayer {
+
+    // Constructors/Destructors
+    public:
+        // Reads the header and start state into cpu, with the base it was recorded against.
+        // Check good() before run().
+        Replayer(Core6502::CPU & cpu, std::istream & in, const uint8_t * base = NULL);
+        ~Replayer();
+
+    // Replay
+    public:
+        // Runs cpu through the rest of the log.  False, with error saying why, when the log is
+        // cut short or malformed, or the CPU asks for reads the log doesn't have.
+        bool run();
+
+        // Runs cpu up to cycle and replays everything logged at or before it.  run() or seek()
+        // carry on from there.  False when cycle is behind the CPU or past End.
+        bool seek(uint64_t cycle);
+
+        bool good() const { return !error; }
+
+        const char * error;         // NULL until something goes wrong
+
+    // Statistics
+    public:
+        uint64_t events;            // Reads and interrupts replayed
+
+    private:
+        Core6502::CPU & cpu;
+        std::istream & in;
+        uint64_t lastCycle;
+
+        struct Input {
+            uint16_t addr;
+            uint8_t value;
+        };
+        std::deque<Input> reads;    // Logged before the next interrupt, not yet asked for
+        bool running;               // Inside runTo(), rather than irq() or nmi()
+
+        uint8_t pendingType;        // Interrupt or End read but not yet reached
+        uint64_t pendingCycle;
+        bool pending, ended;
+
+        bool next(uint8_t & type, uint64_t & cycle, Input & read);
+        bool runTo(uint64_t cycle, bool event);
+        bool play(uint64_t until);
+        static uint8_t input(void * context, uint16_t addr, const Core6502::Bus::Handler & handler);
+
+        Replayer(const Replayer &) = delete;
+        Replayer & operator=(const Replayer &) = delete;
+    };
+
+}
+
+#endif /* Core6502Replay_hpp */
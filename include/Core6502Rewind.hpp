@@ -0,0 +1,105 @@
+//
+//  Core6502Rewind.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+#ifndef Core6502Rewind_hpp
+#define Core6502Rewind_hpp
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <sstream>
+#include <deque>
+#include <vector>
+#include "Core6502.hpp"
+
+namespace Core6502 {
+
+    class Recorder;
+    class Scheduler;
+
+    // Reverse execution for debugging.  Every interval cycles a scheduler event starts a new
+    // replay log (see Core6502Replay.hpp), whose start state is the checkpoint: a save state
+    // delta against the memory image the rewind began with, so pages the program hasn't
+    // touched cost a few bytes.  seek() to an earlier cycle loads the checkpoint at or before
+    // it and replays the logged interrupts and I/O reads up to it, so a seek never emulates
+    // more than interval cycles.  stepBack() goes to the previous instruction boundary.
+    //
+    // Checkpoints and logs are kept within budget bytes by dropping the oldest, which moves
+    // earliest() forward.  The 64 KiB base image isn't counted.
+    //
+    // While the CPU is in the past its scheduler and debugger are detached, so replays don't
+    // hit breakpoints or watchpoints, and devices see nothing: reads come from the log and
+    // writes to I/O pages are dropped.  Don't run the CPU there; resume() replays back to the
+    // present and reattaches everything, after which it carries on as if it had never left.
+    // A rewind uses CPU::recorder, so it can't be combined with a Recorder.  Batch has no
+    // scheduler and can't be rewound.
+    class Rewind {
+
+    // Constructors/Destructors
+    public:
+        // Takes the first checkpoint now and schedules the rest on scheduler, which must be
+        // the CPU's
+        Rewind(Core6502::CPU & cpu, Core6502::Scheduler & scheduler, uint32_t interval, size_t budget);
+        ~Rewind();
+
+    // Seeking
+    public:
+        // Puts the CPU at cycle, with everything that happened at it done.  False, with error
+        // saying why, when cycle is outside earliest() to latest() or the replay failed.
+        bool seek(uint64_t cycle);
+        bool stepBack();                            // To the last instruction boundary before now
+        bool resume();                              // Back to the present
+
+        uint64_t earliest() const;                  // Oldest cycle seek() can reach
+        uint64_t latest() const;                    // The present
+        bool live() const { return recorder != NULL; }
+
+        const char * error;                         // Why the last seek failed, NULL if it didn't
+
+    // Statistics
+    public:
+        size_t size() const;                        // Bytes of checkpoints and logs held
+        uint64_t checkpoints;                       // Taken since construction
+        uint64_t dropped;                           // Dropped to stay within budget
+
+    private:
+        Core6502::CPU & cpu;
+        Core6502::Scheduler & scheduler;
+        uint32_t interval;
+        size_t budget;
+
+        std::vector<uint8_t> base;                  // Memory when the rewind began
+
+        struct Segment {
+            uint64_t start;                         // Cycle of the checkpoint
+            std::string log;                        // Checkpoint and events, empty while recording
+        };
+        std::deque<Segment> segments;               // Oldest first, the last one recording when live
+        size_t finishedSize;                        // Bytes in finished segments
+
+        mutable std::ostringstream log;             // Live segment
+        Core6502::Recorder * recorder;              // Recording it, NULL in the past
+        uint32_t timer;
+
+        uint64_t present;                           // Where the CPU left off, while in the past
+        Core6502::Scheduler * savedScheduler;
+        Core6502::Debugger * savedDebugger;
+
+        void checkpoint();
+        void finishSegment();
+        void trim();
+        void leave();
+        size_t segmentAt(uint64_t cycle) const;
+        bool replay(size_t segment, uint64_t cycle, uint64_t * boundary);
+        static void checkpointDue(Core6502::CPU & cpu, uint64_t cycle, void * context);
+
+        Rewind(const Rewind &) = delete;
+        Rewind & operator=(const Rewind &) = delete;
+    };
+
+}
+
+#endif /* Core6502Rewind_hpp */
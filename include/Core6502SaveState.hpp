@@ -0,0 +1,54 @@
+//
+//  Core6502SaveState.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+#ifndef Core6502SaveState_hpp
+#define Core6502SaveState_hpp
+
+#include <stdint.h>
+#include <iostream>
+
+namespace Core6502 {
+
+    class CPU;
+
+    // Binary save states of a CPU: registers, status, cycle counts and the 64 KiB at
+    // CPU::mem.  Bus mappings and anything outside CPU::mem aren't saved.  All values are
+    // little endian.
+    //
+    //  Header      magic "C652", version, flags, 2 reserved bytes
+    //  Base hash   8 bytes, only with DeltaFlag set
+    //  Registers   PC (2), SP, A, X, Y, status, cyclesRemaining, totalCycles (8)
+    //  Memory      tokens covering all 64 KiB, each a LEB128 varint of (length << 1) | kind.
+    //              Kind 0 is followed by length literal bytes, kind 1 by one byte repeated
+    //              length times.
+    //
+    // With a base image, memory is stored XORed against it, so pages matching the base cost
+    // a few bytes.  Reading needs the same base, checked against its hash.  Writing streams
+    // straight from CPU::mem.  Reading buffers one 64 KiB image so a bad state changes nothing.
+    namespace SaveState {
+
+        static const uint8_t Version = 1;
+        static const uint8_t DeltaFlag = 0x01;      // Memory is XORed against a base image
+
+        // Writes cpu to out, against base when it isn't NULL.  Returns false if the stream
+        // failed.
+        bool write(std::ostream & out, const Core6502::CPU & cpu, const uint8_t * base = NULL);
+
+        // Reads a save state from in into cpu.  Returns false, leaving cpu untouched, on a
+        // stream error, bad magic, a newer version, or a delta state when base is NULL or isn't
+        // the image it was written against.  Memory is decoded into a scratch image and only
+        // copied in once the whole state has parsed; every page is then reported to the bus's
+        // write traps so code caches drop what they translated.
+        bool read(std::istream & in, Core6502::CPU & cpu, const uint8_t * base = NULL);
+
+        // Hash of a 64 KiB base image, as stored in delta states
+        uint64_t hash(const uint8_t * base);
+
+    }
+
+}
+
+#endif /* Core6502SaveState_hpp */
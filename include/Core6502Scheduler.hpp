@@ -0,0 +1,78 @@
+//
+//  Core6502Scheduler.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+#ifndef Core6502Scheduler_hpp
+#define Core6502Scheduler_hpp
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "Core6502.hpp"
+
+namespace Core6502 {
+
+    // Cycle-timestamped events for timers and other devices.  Attach one to CPU::scheduler and
+    // devices schedule a callback for the CPU's totalCycles to reach some value instead of the
+    // host polling them every cycle.  run() and runUntil() then run straight up to the next
+    // event, call everything that's due, and carry on; clock() and step() check after each
+    // call.  Idle loop skipping stops at the next event, so a CPU spinning while it waits for
+    // an interrupt costs nothing between events.
+    //
+    // Events fire at the first instruction boundary at or after their cycle, in cycle order
+    // and then in the order they were scheduled.  A callback may raise irq() or nmi(), touch
+    // the bus, and schedule or cancel events, including rescheduling itself for periodic timers.
+    //
+    // Batch ignores the scheduler.
+    class Scheduler {
+
+    // Constructors/Destructors
+    public:
+        Scheduler();
+
+    // Events
+    public:
+        typedef void (*Callback)(Core6502::CPU & cpu, uint64_t cycle, void * context);
+
+        // Calls callback once totalCycles reaches cycle, returns an id for cancel()
+        uint32_t schedule(uint64_t cycle, Callback callback, void * context = NULL);
+        uint32_t scheduleIn(const Core6502::CPU & cpu, uint64_t delay, Callback callback, void * context = NULL);
+        bool cancel(uint32_t id);                   // False when the event already fired or never existed
+        void clear();                               // Drops every pending event
+
+        size_t pending() const;                     // Events waiting to fire
+        uint64_t next() const;                      // Cycle of the earliest event, UINT64_MAX when none
+
+        // Fires every event due by cpu.totalCycles.  Called by the CPU.
+        inline void dispatch(Core6502::CPU & cpu);
+
+    // Statistics
+    public:
+        uint64_t fired;                             // Events fired since construction
+
+    private:
+        struct Event {
+            uint64_t cycle;
+            uint32_t id;                            // Also the scheduling order
+            Callback callback;
+            void * context;
+        };
+        std::vector<Event> events;                  // Binary min-heap on cycle, then id
+        uint32_t nextID;
+
+        static bool later(const Event & a, const Event & b);
+        void fire(Core6502::CPU & cpu);
+
+        Scheduler(const Scheduler &) = delete;
+        Scheduler & operator=(const Scheduler &) = delete;
+    };
+
+}
+
+inline void Core6502::Scheduler::dispatch(Core6502::CPU & cpu) {
+    if (!events.empty() && events[0].cycle <= cpu.totalCycles) fire(cpu);
+}
+
+#endif /* Core6502Scheduler_hpp */
@@ -0,0 +1,125 @@
+//
+//  Core6502Snapshot.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+#ifndef Core6502Snapshot_hpp
+#define Core6502Snapshot_hpp
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace Core6502 {
+
+    class CPU;
+
+    // Saved registers, status, cycle counts and the 64 KiB at CPU::mem.  Memory is held as
+    // reference counted 256 byte pages, 16 to a reference counted chunk, shared with every
+    // other snapshot they haven't changed between.  Delete a snapshot once it's no longer
+    // needed.
+    class Snapshot {
+
+    // Constructors/Destructors
+    public:
+        ~Snapshot();
+
+    // Saved State
+    public:
+        struct {
+            uint16_t PC;
+            uint8_t  SP;
+            uint8_t  A;
+            uint8_t  X;
+            uint8_t  Y;
+        } registers;
+
+        uint8_t status;
+        uint8_t cyclesRemaining;
+        uint64_t totalCycles;
+
+        const uint8_t * page(uint8_t page) const;   // Saved contents of one page of memory
+
+    // Storage
+    public:
+        static const int ChunkPages = 16;
+        static const int Chunks = 0x100 / ChunkPages;
+
+        struct Page {
+            uint32_t references;
+            uint8_t data[0x100];
+        };
+
+        struct Chunk {
+            uint32_t references;
+            Page * pages[ChunkPages];
+        };
+
+        Chunk * chunks[Chunks];
+
+        static Page * retain(Page * page);
+        static Chunk * retain(Chunk * chunk);
+        static void release(Page * page);
+        static void release(Chunk * chunk);
+
+    private:
+        friend class Snapshots;
+        Snapshot() {}
+        Snapshot(const Snapshot &) = delete;
+        Snapshot & operator=(const Snapshot &) = delete;
+    };
+
+    // Copy-on-write snapshots of one CPU.  A bus write trap marks each page of CPU::mem dirty
+    // on its first write after a snapshot or restore, and stops trapping the page after that.
+    // take() only copies dirty pages and shares the rest with the last snapshot, and restore()
+    // only copies back pages that differ from the snapshot.  Untouched chunks are shared
+    // whole, so both cost O(dirty pages) plus a pass over 16 chunks.
+    //
+    // Pages are tracked through the bus, including mirrors and remaps of CPU::mem.  Memory
+    // outside CPU::mem isn't saved.  Call invalidate() after writing CPU::mem directly or
+    // through pointers the bus doesn't know about.  Restoring a page reports it to the bus's
+    // other traps, so the block cache and JIT drop code they translated from it.
+    class Snapshots {
+
+    // Constructors/Destructors
+    public:
+        Snapshots(Core6502::CPU & cpu);
+        ~Snapshots();
+
+    // Snapshots
+    public:
+        Core6502::Snapshot * take();                        // Caller deletes the snapshot
+        void restore(const Core6502::Snapshot & snapshot);  // Snapshot may come from any CPU
+        void invalidate();                                  // Treats every page as dirty
+
+        // False when the bus had no write trap left, in which case every take() and restore()
+        // copies all 64 KiB
+        bool tracking() const;
+
+    // Statistics
+    public:
+        uint64_t pagesCopied;       // Pages copied by take() and restore()
+
+    private:
+        Core6502::CPU & cpu;
+        int trap;
+        uint32_t mapGeneration;
+
+        // Page whose contents each page of CPU::mem still matches, NULL once dirty, and the
+        // chunk of those pages, NULL once any of them is dirty
+        Snapshot::Page * clean[0x100];
+        Snapshot::Chunk * cleanChunks[Snapshot::Chunks];
+
+        // Bus pages the trap came off since the last snapshot or restore
+        uint8_t untrapped[0x100];
+        int untrappedCount;
+
+        void sync();
+        void retrap();
+        void markDirty(uint8_t page);
+        static void written(void * context, uint16_t addr, uint8_t value);
+    };
+
+}
+
+#endif /* Core6502Snapshot_hpp */
@@ -0,0 +1,138 @@
+//
+//  Core6502Trace.hpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+#ifndef Core6502Trace_hpp
+#define Core6502Trace_hpp
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Core6502.hpp"
+
+namespace Core6502 {
+
+    // Ring buffer of the last instructions a CPU executed, for finding out how a program got
+    // where it failed.  Built with CORE6502_TRACE, every core records each instruction before
+    // running it into CPU::trace when one is attached.  Without CORE6502_TRACE the hooks
+    // compile to nothing and attaching a trace does nothing.  The JIT runs on the switch
+    // core while a trace is attached.
+    //
+    // The CPU's thread is the only writer.  Other threads can copy() the most recent records
+    // while it runs without locking; records overwritten during the copy are left out.
+    class Trace {
+
+    // Constructors/Destructors
+    public:
+        Trace(size_t capacity);     // Records kept, rounded up to one less than a power of two
+        ~Trace();
+
+    // Records
+    public:
+        // State before one instruction ran, 16 bytes
+        struct Record {
+            uint32_t cycle;         // Low 32 bits of the cycle it started on
+            uint16_t PC;
+            uint8_t opCode;
+            uint8_t operands[2];    // Bytes after the opcode, whether the instruction uses them or not
+            uint8_t A;
+            uint8_t X;
+            uint8_t Y;
+            uint8_t SP;
+            uint8_t P;
+            uint8_t reserved[2];
+        };
+
+        size_t capacity() const;
+        uint64_t count() const;     // Records written since construction or clear()
+        void clear();               // Only while the CPU isn't running
+
+        // Copies up to max of the most recent records to out, oldest first, and returns how
+        // many.  Safe to call from any thread.
+        size_t copy(Record * out, size_t max) const;
+
+        // Called by the cores.  status is the CPU's status with any lazy flags folded in, cycle
+        // the cycle count the instruction starts on.
+        inline void record(const Core6502::CPU & cpu, uint8_t status, uint64_t cycle);
+
+        uint64_t base;              // Cycle count the running core's elapsed count starts from
+
+    // Dumps & Decoding
+    public:
+        // Writes the buffered records to out as a dump, magic "C6TR", version, record count,
+        // the full cycle count of the newest record, then 16 bytes per record, little endian
+        bool write(std::ostream & out) const;
+
+        // Reads a dump back, with the full cycle count each record started on
+        static bool read(std::istream & in, std::vector<Record> & records, std::vector<uint64_t> & cycles);
+
+        // One line per record: cycle, PC, instruction bytes, disassembly and registers
+        static std::string disassemble(const Record & record);
+        static std::string format(const Record & record, uint64_t cycle);
+
+    private:
+        Record * records;
+        size_t mask;
+        std::atomic<uint64_t> head;     // Next record to write
+        uint64_t lastCycle;             // Full cycle count of the newest record
+
+        Trace(const Trace &) = delete;
+        Trace & operator=(const Trace &) = delete;
+    };
+
+}
+
+inline void Core6502::Trace::record(const Core6502::CPU & cpu, uint8_t status, uint64_t cycle) {
+
+    uint64_t index = head.load(std::memory_order_relaxed);
+    Record & entry = records[index & mask];
+
+    // Keeps the slot's writes after the store that published the record it replaces, so
+    // copy() can tell when it raced with them
+    std::atomic_thread_fence(std::memory_order_release);
+
+    // Instruction bytes come straight from the page table so I/O handlers never see the trace
+    uint16_t pc = cpu.registers.PC;
+    const uint8_t * page = cpu.bus.mapped(pc >> 8);
+    entry.opCode = page ? page[pc & 0xFF] : 0;
+    for (int i = 0; i < 2; i++) {
+        uint16_t addr = pc + 1 + i;
+        page = cpu.bus.mapped(addr >> 8);
+        entry.operands[i] = page ? page[addr & 0xFF] : 0;
+    }
+
+    entry.cycle = (uint32_t)cycle;
+    entry.PC = pc;
+    entry.A = cpu.registers.A;
+    entry.X = cpu.registers.X;
+    entry.Y = cpu.registers.Y;
+    entry.SP = cpu.registers.SP;
+    entry.P = status;
+    lastCycle = cycle;
+
+    head.store(index + 1, std::memory_order_release);
+
+}
+
+// Hooks used by the cores.  A core copies CPU::trace into a local once with
+// CORE6502_TRACE_ATTACHED so the per-instruction check stays in a register.
+#ifdef CORE6502_TRACE
+#define CORE6502_TRACE_ATTACHED(tracer, cpu) Core6502::Trace * const tracer = (cpu).trace;
+#define CORE6502_TRACE_INSTRUCTION(tracer, cpu, status, elapsed) \
+    if (tracer) (tracer)->record((cpu), (status), (tracer)->base + (elapsed));
+#define CORE6502_TRACE_BASE(cpu, cycles) \
+    if ((cpu).trace) (cpu).trace->base = (cycles);
+#define CORE6502_TRACING(cpu) ((cpu).trace != NULL)
+#else
+#define CORE6502_TRACE_ATTACHED(tracer, cpu)
+#define CORE6502_TRACE_INSTRUCTION(tracer, cpu, status, elapsed)
+#define CORE6502_TRACE_BASE(cpu, cycles)
+#define CORE6502_TRACING(cpu) false
+#endif
+
+#endif /* Core6502Trace_hpp */
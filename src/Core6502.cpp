@@ -6,26 +6,93 @@
 //
 
 #include "Core6502.hpp"
+#include "Core6502Trace.hpp"
+#include "Core6502Profiler.hpp"
+#include "Core6502Scheduler.hpp"
+#include "Core6502Debugger.hpp"
+#include "Core6502Replay.hpp"
+#include "Core6502Decimal.hpp"
 #include <iostream>
+#include <new>
+#include <stdlib.h>
 
 Core6502::CPU::CPU() {
     // Create memory
     mem = new uint8_t[0x10000];
+    bus.mapRAM(0x0000, 0x10000, mem);
+    totalCycles = 0;
+    interpreter = CORE6502_DEFAULT_INTERPRETER;
+    blockCache = interpreter == Core6502::Interpreter::Cached ? new Core6502::BlockCache(bus) : NULL;
+#ifdef CORE6502_JIT
+    jit = interpreter == Core6502::Interpreter::JIT ? new Core6502::JIT(*this) : NULL;
+#endif
+    trace = NULL;
+    profiler = NULL;
+    scheduler = NULL;
+    debugger = NULL;
+    recorder = NULL;
+    idleSkipping = true;
+    idleCyclesSkipped = 0;
+    cyclesRemaining = 0;
+    extraCycles = 0;
 
     // Setup instruction map
     setupInstructionMap();
+    Core6502::Decimal::initialize();
 }
 
-Core6502::CPU::CPU(uint8_t * memPtr) {
+Core6502::CPU::CPU(uint8_t * memPtr, Core6502::Interpreter interpreter) {
     
     // Set memory location
     mem = memPtr;
+    bus.mapRAM(0x0000, 0x10000, mem);
+    totalCycles = 0;
+    this->interpreter = interpreter;
+    blockCache = interpreter == Core6502::Interpreter::Cached ? new Core6502::BlockCache(bus) : NULL;
+#ifdef CORE6502_JIT
+    jit = interpreter == Core6502::Interpreter::JIT ? new Core6502::JIT(*this) : NULL;
+#endif
+    trace = NULL;
+    profiler = NULL;
+    scheduler = NULL;
+    debugger = NULL;
+    recorder = NULL;
+    idleSkipping = true;
+    idleCyclesSkipped = 0;
+    cyclesRemaining = 0;
+    extraCycles = 0;
     
     // Setup instruction map
     setupInstructionMap();
+    Core6502::Decimal::initialize();
+
+}
+
+Core6502::CPU::~CPU() {
+    delete blockCache;
+#ifdef CORE6502_JIT
+    delete jit;
+#endif
+}
+
+void * Core6502::CPU::operator new(size_t size) {
+
+    // Over-allocate so the object can be moved up to a 64 byte boundary, keeping
+    // the original pointer just in front of it for delete
+    void * raw = malloc(size + 64 + sizeof(void *));
+    if (!raw) throw std::bad_alloc();
+
+    uintptr_t aligned = ((uintptr_t)raw + sizeof(void *) + 63) & ~(uintptr_t)63;
+    ((void **)aligned)[-1] = raw;
+
+    return (void *)aligned;
 
 }
 
+void Core6502::CPU::operator delete(void * ptr) {
+    if (ptr) free(((void **)ptr)[-1]);
+}
+
 void Core6502::CPU::reset() {
 
     // Set PC to 0xFFFC and all other registers to 0
@@ -51,26 +118,101 @@ void Core6502::CPU::reset() {
 
     // Reset internals
     cyclesRemaining = 0;
+    extraCycles = 0;
+
+    // Code may have been loaded straight into mem
+    if (blockCache) blockCache->flush();
+#ifdef CORE6502_JIT
+    if (jit) jit->flush();
+#endif
 
 }
 
-uint8_t Core6502::CPU::fetchByte() {
+// Fetches, decodes and executes one instruction, returning the cycles it takes
+inline uint8_t Core6502::CPU::execute() {
+
+#ifdef CORE6502_JIT
+    // Translations aren't traced or profiled, the switch core stands in for them
+    if (interpreter == Core6502::Interpreter::JIT && jit->available() && !CORE6502_TRACING(*this) && !CORE6502_PROFILING(*this))
+        return jit->run(1, -1);
+#endif
+
+    // The cached core has nothing to gain from a single instruction
+    if (interpreter != Core6502::Interpreter::Table)
+        return interpret(1, -1, NULL);
 
-    // Grab value from memory at PC index and increment PC
-    uint8_t value = mem[registers.PC];
-    registers.PC++;
+    CORE6502_TRACE_INSTRUCTION(trace, *this, status.raw, 0)
+    CORE6502_PROFILE_INSTRUCTION(profiler, *this, 0)
+    Core6502::Instruction & inst = instructions[fetchByte()];
+    inst.instructionFunction(*this, inst);
 
-    return value;
+    uint8_t cycles = inst.cycles + extraCycles;
+    extraCycles = 0;
+
+    return cycles;
 
 }
 
-uint8_t Core6502::CPU::fetchFromMemory(Core6502::Instruction &instruction) {
+// Shared body of run()/runUntil().  Stops at the first instruction boundary where PC
+// equals stopPC or predicate returns true, or once cycles have been used.  Any overshoot
+// of the last instruction is left in cyclesRemaining so following clock() calls line up
+// with having called clock() once per cycle instead.
+uint32_t Core6502::CPU::runLoop(uint32_t cycles, int32_t stopPC, bool (*predicate)(Core6502::CPU&)) {
+
+    // Drain the instruction that's partially clocked
+    if (cyclesRemaining >= cycles) {
+        cyclesRemaining -= cycles;
+        totalCycles += cycles;
+        return cycles;
+    }
+
+    uint32_t elapsed = cyclesRemaining;
+    cyclesRemaining = 0;
+
+    // A CPU left spinning by the last run is still spinning
+    if (idleSkipping && !predicate && !CORE6502_TRACING(*this) && !CORE6502_PROFILING(*this))
+        elapsed += skipIdle(cycles - elapsed, stopPC);
+
+    CORE6502_TRACE_BASE(*this, totalCycles + elapsed)
+    CORE6502_PROFILE_BASE(*this, totalCycles + elapsed)
+
+    if (elapsed >= cycles) {
+        // Used up in an idle loop
+    } else if (interpreter == Core6502::Interpreter::Switch) {
+        elapsed += interpret(cycles - elapsed, stopPC, predicate);
+    } else if (interpreter == Core6502::Interpreter::Cached) {
+        elapsed += runCached(cycles - elapsed, stopPC, predicate);
+#ifdef CORE6502_JIT
+    } else if (interpreter == Core6502::Interpreter::JIT) {
+        // Predicates aren't compiled in and translations aren't traced or profiled, run
+        // those, and everything when no executable memory could be mapped, on the switch core
+        if (predicate || !jit->available() || CORE6502_TRACING(*this) || CORE6502_PROFILING(*this)) elapsed += interpret(cycles - elapsed, stopPC, predicate);
+        else elapsed += jit->run(cycles - elapsed, stopPC);
+#endif
+    } else {
+        CORE6502_TRACE_BASE(*this, totalCycles)
+        CORE6502_PROFILE_BASE(*this, totalCycles)
+        CORE6502_TRACE_ATTACHED(tracer, *this)
+        CORE6502_PROFILE_ATTACHED(profile, *this)
+        while (elapsed < cycles && registers.PC != stopPC && !(predicate && predicate(*this))) {
+            CORE6502_TRACE_INSTRUCTION(tracer, *this, status.raw, elapsed)
+            CORE6502_PROFILE_INSTRUCTION(profile, *this, elapsed)
+            Core6502::Instruction & inst = instructions[fetchByte()];
+            inst.instructionFunction(*this, inst);
+            elapsed += inst.cycles + extraCycles;
+            extraCycles = 0;
+        }
+    }
+
+    // Carry overshoot into the next call
+    if (elapsed > cycles) {
+        cyclesRemaining = elapsed - cycles;
+        elapsed = cycles;
+    }
+
+    totalCycles += elapsed;
 
-    // Perform addressing operation
-    if (instruction.addressFunction != Core6502::CPU::immediate)
-        return mem[instruction.addressFunction(*this)];
-    else
-        return instruction.addressFunction(*this);
+    return elapsed;
 
 }
 
@@ -79,37 +221,83 @@ void Core6502::CPU::clock() {
     // If cycles remaining is zero, fetch opcode and execute
     if (!cyclesRemaining) {
         
-        // Set instruction and remaining cycles
-        Core6502::Instruction & inst = instructions[fetchByte()];
-        cyclesRemaining = inst.cycles - 1;
-
-        // Execute instruction
-        inst.instructionFunction(*this, inst);
+        // Execute instruction and set remaining cycles
+        CORE6502_TRACE_BASE(*this, totalCycles)
+        CORE6502_PROFILE_BASE(*this, totalCycles)
+        cyclesRemaining = execute() - 1;
 
     } else {
         // Decrement cycles remaining
         cyclesRemaining--;
     }
 
+    totalCycles++;
+
+    if (scheduler) scheduler->dispatch(*this);
+
+}
+
+uint8_t Core6502::CPU::step() {
+
+    // Finish off whatever is left of the current instruction
+    uint8_t cycles = cyclesRemaining;
+    cyclesRemaining = 0;
+
+    CORE6502_TRACE_BASE(*this, totalCycles + cycles)
+    CORE6502_PROFILE_BASE(*this, totalCycles + cycles)
+    cycles += execute();
+    totalCycles += cycles;
+
+    if (scheduler) scheduler->dispatch(*this);
+
+    return cycles;
+
+}
+
+uint32_t Core6502::CPU::runEntry(uint32_t cycles, int32_t stopPC, bool (*predicate)(Core6502::CPU&)) {
+
+    // Breakpoints and watchpoints only cost anything once armed, as a predicate
+    if (debugger && debugger->begin(predicate)) predicate = Core6502::Debugger::check;
+
+    return scheduler ? runScheduled(cycles, stopPC, predicate) : runLoop(cycles, stopPC, predicate);
+
+}
+
+uint32_t Core6502::CPU::run(uint32_t cycles) {
+
+    runEntry(cycles, -1, NULL);
+
+    return cyclesRemaining;
+
+}
+
+uint32_t Core6502::CPU::runUntil(uint16_t pc, uint32_t cycles) {
+    return runEntry(cycles, pc, NULL);
+}
+
+uint32_t Core6502::CPU::runUntil(bool (*predicate)(Core6502::CPU&), uint32_t cycles) {
+    return runEntry(cycles, -1, predicate);
 }
 
 void Core6502::CPU::irq() {
 
+    if (recorder) recorder->interrupt(Core6502::Replay::IRQ);
+
     // Interrupt if enabled
     if (!status.bitfield.InterruptDisable) {
         // Push PC onto stack
-        mem[registers.SP] = (uint8_t)(registers.PC >> 8);
+        write(registers.SP, (uint8_t)(registers.PC >> 8));
         registers.SP--;
-        mem[registers.SP] = (uint8_t)(registers.PC & 0xFF);
+        write(registers.SP, (uint8_t)(registers.PC & 0xFF));
         registers.SP--;
 
         // Push cpu status onto stack
-        mem[registers.SP] = status.raw;
+        write(registers.SP, status.raw);
         registers.SP--;
 
         // Set PC to IRQ vector
-        registers.PC =  mem[0xFFFF] << 8;
-        registers.PC |= mem[0xFFFE];
+        registers.PC =  read(0xFFFF) << 8;
+        registers.PC |= read(0xFFFE);
 
         // Set break status
         status.bitfield.BreakCommand = 0x1;
@@ -119,331 +307,33 @@ void Core6502::CPU::irq() {
 
 void Core6502::CPU::nmi() {
 
+    if (recorder) recorder->interrupt(Core6502::Replay::NMI);
+
     // Push PC onto stack
-    mem[registers.SP] = (uint8_t)(registers.PC >> 8);
+    write(registers.SP, (uint8_t)(registers.PC >> 8));
     registers.SP--;
-    mem[registers.SP] = (uint8_t)(registers.PC & 0xFF);
+    write(registers.SP, (uint8_t)(registers.PC & 0xFF));
     registers.SP--;
 
     // Push cpu status onto stack
-    mem[registers.SP] = status.raw;
+    write(registers.SP, status.raw);
     registers.SP--;
 
     // Set PC to IRQ vector
-    registers.PC =  mem[0xFFFB];
-    registers.PC |= mem[0xFFFA] << 8;
+    registers.PC =  read(0xFFFB);
+    registers.PC |= read(0xFFFA) << 8;
 
     // Set break status
     status.bitfield.BreakCommand = 0x1;
 
 }
 
-uint16_t Core6502::CPU::immediate(Core6502::CPU &cpu) {
-    return cpu.fetchByte();
-}
-uint16_t Core6502::CPU::zeroPageAddr(Core6502::CPU &cpu) {
-    // Return fetched byte
-    return cpu.fetchByte();
-}
-uint16_t Core6502::CPU::zeroPageXAddr(Core6502::CPU &cpu) {
-    // Fetch Offset and add value of X register
-    return (uint8_t)(cpu.fetchByte() + cpu.registers.X);
-}
-uint16_t Core6502::CPU::zeroPageYAddr(Core6502::CPU &cpu) {
-    // Fetch Offset and add value of Y register
-    return (uint8_t)(cpu.fetchByte() + cpu.registers.Y);
-}
-uint16_t Core6502::CPU::absoluteAddr(Core6502::CPU &cpu) {
-    // Fetch 16-bit address
-    return cpu.fetchByte() + (cpu.fetchByte() << 8);
-}
-uint16_t Core6502::CPU::absoluteXAddr(Core6502::CPU &cpu) {
-    // Fetch 16-bit address and add offset from X register
-    uint16_t addr  = cpu.fetchByte();
-             addr += (cpu.fetchByte() << 8);
-             addr += cpu.registers.X;
-
-    return addr;
-}
-uint16_t Core6502::CPU::absoluteYAddr(Core6502::CPU &cpu) {
-    // Fetch 16-bit address and add offset from Y register
-    uint16_t addr  = cpu.fetchByte();
-             addr += (cpu.fetchByte() << 8);
-             addr += cpu.registers.Y;
-
-    return addr;
-}
-uint16_t Core6502::CPU::indirectXAddr(Core6502::CPU &cpu) {
-    // Fetch offset and add value in register X
-    uint8_t zero_addr =  cpu.fetchByte();
-            zero_addr += cpu.registers.X;
-    
-    // Read 16-bit address from zero page address
-    uint16_t effective_addr =  cpu.mem[zero_addr];
-             effective_addr += (cpu.mem[zero_addr + 1] << 8);
-
-    return effective_addr;
-}
-uint16_t Core6502::CPU::indirectYAddr(Core6502::CPU &cpu) {
-    // Fetch 16-bit address from zero page memory
-    uint8_t offset = cpu.fetchByte();
-    uint16_t effective_addr =  cpu.mem[offset];
-             effective_addr += (cpu.mem[offset + 1] << 8);
-
-    // Add Y to effecting address
-    effective_addr += cpu.registers.Y;
-
-    return effective_addr;
-}
-uint16_t Core6502::CPU::indirectAddr(Core6502::CPU &cpu) {
-    // Fetch 16-bit address from address specified by passed in address
-    // Note.  This implementation contains the page boundary bug in the
-    // Original 6502.  See http://obelisk.me.uk/6502/reference.html#JMP
-    // for details.
-    uint8_t LB = cpu.fetchByte();
-    uint8_t UB = cpu.fetchByte();
-
-    // Get final address
-    uint16_t memAddr =  LB + (UB << 8);
-    
-    uint16_t effectiveAddr =  cpu.mem[memAddr];
-    
-    // Implement page boundary bug
-    if (LB == 0xFF) effectiveAddr += (cpu.mem[(memAddr & 0xFF00)] << 8);    
-    else effectiveAddr += (cpu.mem[memAddr + 1] << 8);
-             
-
-    return effectiveAddr;
+void Core6502::CPU::setupInstructionMap() {
 
-}
-uint16_t Core6502::CPU::relativeAddr(Core6502::CPU &cpu) {
-    // Fetch signed byte and add to PC
-    int8_t offset = cpu.fetchByte();
-    
-    uint16_t addr = cpu.registers.PC + offset;
+    // Fill table from the default opcode table.  Undocumented opcodes execute as a two cycle NOP.
+#define CORE6502_OPCODE(opCode, cycles, operation, addressing) \
+    instructions[opCode] = (Core6502::Instruction){opCode, cycles, Core6502::operation, CORE6502_ADDRESSING_##addressing};
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
 
-    return addr;
-    
-}
-uint16_t Core6502::CPU::accumlatorAddr(Core6502::CPU &cpu) {
-    return cpu.registers.A;
 }
-
-void Core6502::CPU::setupInstructionMap() {
-    
-    // LDA Instructions
-    instructions[0xA9] = (Core6502::Instruction){0xA9, 2, Core6502::LDA, Core6502::CPU::immediate};
-    instructions[0xA5] = (Core6502::Instruction){0xA5, 3, Core6502::LDA, Core6502::CPU::zeroPageAddr};
-    instructions[0xB5] = (Core6502::Instruction){0xB5, 4, Core6502::LDA, Core6502::CPU::zeroPageXAddr};
-    instructions[0xAD] = (Core6502::Instruction){0xAD, 4, Core6502::LDA, Core6502::CPU::absoluteAddr};
-    instructions[0xBD] = (Core6502::Instruction){0xBD, 4, Core6502::LDA, Core6502::CPU::absoluteXAddr};
-    instructions[0xB9] = (Core6502::Instruction){0xB9, 4, Core6502::LDA, Core6502::CPU::absoluteYAddr};
-    instructions[0xA1] = (Core6502::Instruction){0xA1, 6, Core6502::LDA, Core6502::CPU::indirectXAddr};
-    instructions[0xB1] = (Core6502::Instruction){0xB1, 5, Core6502::LDA, Core6502::CPU::indirectYAddr};
-
-    // LDX Instructions
-    instructions[0xA2] = (Core6502::Instruction){0xA2, 2, Core6502::LDX, Core6502::CPU::immediate};
-    instructions[0xA6] = (Core6502::Instruction){0xA6, 3, Core6502::LDX, Core6502::CPU::zeroPageAddr};
-    instructions[0xB6] = (Core6502::Instruction){0xB6, 4, Core6502::LDX, Core6502::CPU::zeroPageYAddr};
-    instructions[0xAE] = (Core6502::Instruction){0xAE, 4, Core6502::LDX, Core6502::CPU::absoluteAddr};
-    instructions[0xBE] = (Core6502::Instruction){0xBE, 4, Core6502::LDX, Core6502::CPU::absoluteYAddr};
-
-    // LDY Instructions
-    instructions[0xA0] = (Core6502::Instruction){0xA0, 2, Core6502::LDY , Core6502::CPU::immediate};
-    instructions[0xA4] = (Core6502::Instruction){0xA4, 3, Core6502::LDY , Core6502::CPU::zeroPageAddr};
-    instructions[0xB4] = (Core6502::Instruction){0xB4, 4, Core6502::LDY , Core6502::CPU::zeroPageXAddr};
-    instructions[0xAC] = (Core6502::Instruction){0xAC, 4, Core6502::LDY , Core6502::CPU::absoluteAddr};
-    instructions[0xBC] = (Core6502::Instruction){0xBC, 4, Core6502::LDY , Core6502::CPU::absoluteXAddr};
-
-    // STA Instructions
-    instructions[0x85] = (Core6502::Instruction){0x85, 3, Core6502::STA, Core6502::CPU::zeroPageAddr};
-    instructions[0x95] = (Core6502::Instruction){0x95, 4, Core6502::STA, Core6502::CPU::zeroPageXAddr};
-    instructions[0x8D] = (Core6502::Instruction){0x8D, 4, Core6502::STA, Core6502::CPU::absoluteAddr};
-    instructions[0x9D] = (Core6502::Instruction){0x9D, 5, Core6502::STA, Core6502::CPU::absoluteXAddr};
-    instructions[0x99] = (Core6502::Instruction){0x99, 5, Core6502::STA, Core6502::CPU::absoluteYAddr};
-    instructions[0x81] = (Core6502::Instruction){0x81, 6, Core6502::STA, Core6502::CPU::indirectXAddr};
-    instructions[0x91] = (Core6502::Instruction){0x91, 6, Core6502::STA, Core6502::CPU::indirectYAddr};
-
-    // STX Instructions
-    instructions[0x86] = (Core6502::Instruction){0x86, 3, Core6502::STX, Core6502::CPU::zeroPageAddr};
-    instructions[0x96] = (Core6502::Instruction){0x96, 4, Core6502::STX, Core6502::CPU::zeroPageYAddr};
-    instructions[0x8E] = (Core6502::Instruction){0x8E, 4, Core6502::STX, Core6502::CPU::absoluteAddr};
-     
-    // STY Instructions
-    instructions[0x84] = (Core6502::Instruction){0x84, 3, Core6502::STY, Core6502::CPU::zeroPageAddr};
-    instructions[0x94] = (Core6502::Instruction){0x94, 4, Core6502::STY, Core6502::CPU::zeroPageXAddr};
-    instructions[0x8C] = (Core6502::Instruction){0x8C, 4, Core6502::STY, Core6502::CPU::absoluteAddr};
-
-    // AND Instructions
-    instructions[0x29] = (Core6502::Instruction){0x29, 2, Core6502::AND, Core6502::CPU::immediate};
-    instructions[0x25] = (Core6502::Instruction){0x25, 3, Core6502::AND, Core6502::CPU::zeroPageAddr};
-    instructions[0x35] = (Core6502::Instruction){0x35, 4, Core6502::AND, Core6502::CPU::zeroPageXAddr};
-    instructions[0x2D] = (Core6502::Instruction){0x2D, 4, Core6502::AND, Core6502::CPU::absoluteAddr};
-    instructions[0x3D] = (Core6502::Instruction){0x3D, 4, Core6502::AND, Core6502::CPU::absoluteXAddr};
-    instructions[0x39] = (Core6502::Instruction){0x39, 4, Core6502::AND, Core6502::CPU::absoluteYAddr};
-    instructions[0x21] = (Core6502::Instruction){0x21, 6, Core6502::AND, Core6502::CPU::indirectXAddr};
-    instructions[0x31] = (Core6502::Instruction){0x31, 5, Core6502::AND, Core6502::CPU::indirectYAddr};
-
-    // OR Instructions
-    instructions[0x09] = (Core6502::Instruction){0x09, 2, Core6502::ORA, Core6502::CPU::immediate};
-    instructions[0x05] = (Core6502::Instruction){0x05, 3, Core6502::ORA, Core6502::CPU::zeroPageAddr};
-    instructions[0x15] = (Core6502::Instruction){0x15, 4, Core6502::ORA, Core6502::CPU::zeroPageXAddr};
-    instructions[0x0D] = (Core6502::Instruction){0x0D, 4, Core6502::ORA, Core6502::CPU::absoluteAddr};
-    instructions[0x1D] = (Core6502::Instruction){0x1D, 4, Core6502::ORA, Core6502::CPU::absoluteXAddr};
-    instructions[0x19] = (Core6502::Instruction){0x19, 4, Core6502::ORA, Core6502::CPU::absoluteYAddr};
-    instructions[0x01] = (Core6502::Instruction){0x01, 6, Core6502::ORA, Core6502::CPU::indirectXAddr};
-    instructions[0x11] = (Core6502::Instruction){0x11, 5, Core6502::ORA, Core6502::CPU::indirectYAddr};
-
-    // EOR Instructions
-    instructions[0x49] = (Core6502::Instruction){0x49, 2, Core6502::EOR, Core6502::CPU::immediate};
-    instructions[0x45] = (Core6502::Instruction){0x45, 3, Core6502::EOR, Core6502::CPU::zeroPageAddr};
-    instructions[0x55] = (Core6502::Instruction){0x55, 4, Core6502::EOR, Core6502::CPU::zeroPageXAddr};
-    instructions[0x4D] = (Core6502::Instruction){0x4D, 4, Core6502::EOR, Core6502::CPU::absoluteAddr};
-    instructions[0x5D] = (Core6502::Instruction){0x5D, 4, Core6502::EOR, Core6502::CPU::absoluteXAddr};
-    instructions[0x59] = (Core6502::Instruction){0x59, 4, Core6502::EOR, Core6502::CPU::absoluteYAddr};
-    instructions[0x41] = (Core6502::Instruction){0x41, 6, Core6502::EOR, Core6502::CPU::indirectXAddr};
-    instructions[0x51] = (Core6502::Instruction){0x51, 5, Core6502::EOR, Core6502::CPU::indirectYAddr};
-
-    // ROL Instructions
-    instructions[0x2A] = (Core6502::Instruction){0x2A, 2, Core6502::ROL, Core6502::CPU::accumlatorAddr};
-    instructions[0x26] = (Core6502::Instruction){0x26, 5, Core6502::ROL, Core6502::CPU::zeroPageAddr};
-    instructions[0x36] = (Core6502::Instruction){0x36, 6, Core6502::ROL, Core6502::CPU::zeroPageXAddr};
-    instructions[0x2E] = (Core6502::Instruction){0x2E, 6, Core6502::ROL, Core6502::CPU::absoluteAddr};
-    instructions[0x3E] = (Core6502::Instruction){0x3E, 7, Core6502::ROL, Core6502::CPU::absoluteXAddr};
-
-    // ROR Instructions
-    instructions[0x6A] = (Core6502::Instruction){0x6A, 2, Core6502::ROR, Core6502::CPU::accumlatorAddr};
-    instructions[0x66] = (Core6502::Instruction){0x66, 5, Core6502::ROR, Core6502::CPU::zeroPageAddr};
-    instructions[0x76] = (Core6502::Instruction){0x76, 6, Core6502::ROR, Core6502::CPU::zeroPageXAddr};
-    instructions[0x6E] = (Core6502::Instruction){0x6E, 6, Core6502::ROR, Core6502::CPU::absoluteAddr};
-    instructions[0x7E] = (Core6502::Instruction){0x7E, 7, Core6502::ROR, Core6502::CPU::absoluteXAddr};
-
-    // ASL Instructions
-    instructions[0x0A] = (Core6502::Instruction){0x0A, 2, Core6502::ASL, Core6502::CPU::accumlatorAddr};
-    instructions[0x06] = (Core6502::Instruction){0x06, 5, Core6502::ASL, Core6502::CPU::zeroPageAddr};
-    instructions[0x16] = (Core6502::Instruction){0x16, 6, Core6502::ASL, Core6502::CPU::zeroPageXAddr};
-    instructions[0x0E] = (Core6502::Instruction){0x0E, 6, Core6502::ASL, Core6502::CPU::absoluteAddr};
-    instructions[0x1E] = (Core6502::Instruction){0x1E, 7, Core6502::ASL, Core6502::CPU::absoluteXAddr};
-
-    // LSR Instructions
-    instructions[0x4A] = (Core6502::Instruction){0x4A, 2, Core6502::LSR, Core6502::CPU::accumlatorAddr};
-    instructions[0x46] = (Core6502::Instruction){0x46, 5, Core6502::LSR, Core6502::CPU::zeroPageAddr};
-    instructions[0x56] = (Core6502::Instruction){0x56, 6, Core6502::LSR, Core6502::CPU::zeroPageXAddr};
-    instructions[0x4E] = (Core6502::Instruction){0x4E, 6, Core6502::LSR, Core6502::CPU::absoluteAddr};
-    instructions[0x5E] = (Core6502::Instruction){0x5E, 7, Core6502::LSR, Core6502::CPU::absoluteXAddr};
-
-    // BIT Instructions
-    instructions[0x24] = (Core6502::Instruction){0x24, 3, Core6502::BIT, Core6502::CPU::zeroPageAddr};
-    instructions[0x2C] = (Core6502::Instruction){0x2C, 4, Core6502::BIT, Core6502::CPU::absoluteAddr};
-
-    // CMP Instructions
-    instructions[0xC9] = (Core6502::Instruction){0xC9, 2, Core6502::CMP, Core6502::CPU::immediate};
-    instructions[0xC5] = (Core6502::Instruction){0xC5, 3, Core6502::CMP, Core6502::CPU::zeroPageAddr};
-    instructions[0xD5] = (Core6502::Instruction){0xD5, 4, Core6502::CMP, Core6502::CPU::zeroPageXAddr};
-    instructions[0xCD] = (Core6502::Instruction){0xCD, 4, Core6502::CMP, Core6502::CPU::absoluteAddr};
-    instructions[0xDD] = (Core6502::Instruction){0xDD, 4, Core6502::CMP, Core6502::CPU::absoluteXAddr};
-    instructions[0xD9] = (Core6502::Instruction){0xD9, 4, Core6502::CMP, Core6502::CPU::absoluteYAddr};
-    instructions[0xC1] = (Core6502::Instruction){0xC1, 6, Core6502::CMP, Core6502::CPU::indirectXAddr};
-    instructions[0xD1] = (Core6502::Instruction){0xD1, 5, Core6502::CMP, Core6502::CPU::indirectYAddr};
-
-    // CPX Instructions
-    instructions[0xE0] = (Core6502::Instruction){0xE0, 2, Core6502::CPX, Core6502::CPU::immediate};
-    instructions[0xE4] = (Core6502::Instruction){0xE4, 3, Core6502::CPX, Core6502::CPU::zeroPageAddr};
-    instructions[0xEC] = (Core6502::Instruction){0xEC, 4, Core6502::CPX, Core6502::CPU::absoluteAddr};
-
-    // CPY Instructions
-    instructions[0xC0] = (Core6502::Instruction){0xC0, 2, Core6502::CPY, Core6502::CPU::immediate};
-    instructions[0xC4] = (Core6502::Instruction){0xC4, 3, Core6502::CPY, Core6502::CPU::zeroPageAddr};
-    instructions[0xCC] = (Core6502::Instruction){0xCC, 4, Core6502::CPY, Core6502::CPU::absoluteAddr};
-
-    // INC Instructions
-    instructions[0xE6] = (Core6502::Instruction){0xE6, 5, Core6502::INC, Core6502::CPU::zeroPageAddr};
-    instructions[0xF6] = (Core6502::Instruction){0xF6, 6, Core6502::INC, Core6502::CPU::zeroPageXAddr};
-    instructions[0xEE] = (Core6502::Instruction){0xEE, 6, Core6502::INC, Core6502::CPU::absoluteAddr};
-    instructions[0xFE] = (Core6502::Instruction){0xFE, 7, Core6502::INC, Core6502::CPU::absoluteXAddr};
-
-    // INX Instructions
-    instructions[0xE8] = (Core6502::Instruction){0xE8, 2, Core6502::INX};
-
-    // INY Instructions
-    instructions[0xC8] = (Core6502::Instruction){0xC8, 2, Core6502::INY};
-
-    // DEC Instructions
-    instructions[0xC6] = (Core6502::Instruction){0xC6, 5, Core6502::DEC, Core6502::CPU::zeroPageAddr};
-    instructions[0xD6] = (Core6502::Instruction){0xD6, 6, Core6502::DEC, Core6502::CPU::zeroPageXAddr};
-    instructions[0xCE] = (Core6502::Instruction){0xCE, 6, Core6502::DEC, Core6502::CPU::absoluteAddr};
-    instructions[0xDE] = (Core6502::Instruction){0xDE, 7, Core6502::DEC, Core6502::CPU::absoluteXAddr};
-
-    // DEX Instructions
-    instructions[0xCA] = (Core6502::Instruction){0xCA, 2, Core6502::DEX};
-    
-    // DEY Instructions
-    instructions[0x88] = (Core6502::Instruction){0x88, 2, Core6502::DEY};
-
-    // ADC Instructions
-    instructions[0x69] = (Core6502::Instruction){0x69, 2, Core6502::ADC, Core6502::CPU::immediate};
-    instructions[0x65] = (Core6502::Instruction){0x65, 3, Core6502::ADC, Core6502::CPU::zeroPageAddr};
-    instructions[0x75] = (Core6502::Instruction){0x75, 4, Core6502::ADC, Core6502::CPU::zeroPageXAddr};
-    instructions[0x6D] = (Core6502::Instruction){0x6D, 4, Core6502::ADC, Core6502::CPU::absoluteAddr};
-    instructions[0x7D] = (Core6502::Instruction){0x7D, 4, Core6502::ADC, Core6502::CPU::absoluteXAddr};
-    instructions[0x79] = (Core6502::Instruction){0x79, 4, Core6502::ADC, Core6502::CPU::absoluteYAddr};
-    instructions[0x61] = (Core6502::Instruction){0x61, 6, Core6502::ADC, Core6502::CPU::indirectXAddr};
-    instructions[0x71] = (Core6502::Instruction){0x71, 5, Core6502::ADC, Core6502::CPU::indirectYAddr};
-
-    // SBC Instructions
-    instructions[0xE9] = (Core6502::Instruction){0xE9, 2, Core6502::SBC, Core6502::CPU::immediate};
-    instructions[0xE5] = (Core6502::Instruction){0xE5, 3, Core6502::SBC, Core6502::CPU::zeroPageAddr};
-    instructions[0xF5] = (Core6502::Instruction){0xF5, 4, Core6502::SBC, Core6502::CPU::zeroPageXAddr};
-    instructions[0xED] = (Core6502::Instruction){0xED, 4, Core6502::SBC, Core6502::CPU::absoluteAddr};
-    instructions[0xFD] = (Core6502::Instruction){0xFD, 4, Core6502::SBC, Core6502::CPU::absoluteXAddr};
-    instructions[0xF9] = (Core6502::Instruction){0xF9, 4, Core6502::SBC, Core6502::CPU::absoluteYAddr};
-    instructions[0xE1] = (Core6502::Instruction){0xE1, 6, Core6502::SBC, Core6502::CPU::indirectXAddr};
-    instructions[0xF1] = (Core6502::Instruction){0xF1, 5, Core6502::SBC, Core6502::CPU::indirectYAddr};
-
-    // Transfer Instructions
-    instructions[0xAA] = (Core6502::Instruction){0xAA, 2, Core6502::TAX};
-    instructions[0xA8] = (Core6502::Instruction){0xA8, 2, Core6502::TAY};
-    instructions[0x8A] = (Core6502::Instruction){0x8A, 2, Core6502::TXA};
-    instructions[0x98] = (Core6502::Instruction){0x98, 2, Core6502::TYA};
-
-    // JMP Instructions
-    instructions[0x4C] = (Core6502::Instruction){0x4C, 3, Core6502::JMP, Core6502::CPU::absoluteAddr};
-    instructions[0x6C] = (Core6502::Instruction){0x6C, 5, Core6502::JMP, Core6502::CPU::indirectAddr}; 
-    instructions[0x20] = (Core6502::Instruction){0x20, 6, Core6502::JSR, Core6502::CPU::absoluteAddr};
-    instructions[0x60] = (Core6502::Instruction){0x60, 6, Core6502::RTS};
-
-    // Branch Instructions
-    instructions[0x90] = (Core6502::Instruction){0x90, 2, Core6502::BCC, Core6502::CPU::relativeAddr};
-    instructions[0xB0] = (Core6502::Instruction){0xB0, 2, Core6502::BCS, Core6502::CPU::relativeAddr};
-    instructions[0xF0] = (Core6502::Instruction){0xF0, 2, Core6502::BEQ, Core6502::CPU::relativeAddr};
-    instructions[0x30] = (Core6502::Instruction){0x30, 2, Core6502::BMI, Core6502::CPU::relativeAddr};
-    instructions[0xD0] = (Core6502::Instruction){0xD0, 2, Core6502::BNE, Core6502::CPU::relativeAddr};
-    instructions[0x10] = (Core6502::Instruction){0x10, 2, Core6502::BPL, Core6502::CPU::relativeAddr};
-    instructions[0x50] = (Core6502::Instruction){0x50, 2, Core6502::BVC, Core6502::CPU::relativeAddr};
-    instructions[0x70] = (Core6502::Instruction){0x70, 2, Core6502::BVS, Core6502::CPU::relativeAddr};
-
-    // Status Flag Instructions
-    instructions[0x18] = (Core6502::Instruction){0x18, 2, Core6502::CLC};
-    instructions[0xD8] = (Core6502::Instruction){0xD8, 2, Core6502::CLD};
-    instructions[0x58] = (Core6502::Instruction){0x58, 2, Core6502::CLI};
-    instructions[0xB8] = (Core6502::Instruction){0xB8, 2, Core6502::CLV};
-    instructions[0x38] = (Core6502::Instruction){0x38, 2, Core6502::SEC};
-    instructions[0xF8] = (Core6502::Instruction){0xF8, 2, Core6502::SED};
-    instructions[0x78] = (Core6502::Instruction){0x78, 2, Core6502::SEI};
-
-    // Stack Instructions
-    instructions[0xBA] = (Core6502::Instruction){0xBA, 2, Core6502::TSX};
-    instructions[0x9A] = (Core6502::Instruction){0x9A, 2, Core6502::TXS};
-    instructions[0x48] = (Core6502::Instruction){0x48, 3, Core6502::PHA};
-    instructions[0x08] = (Core6502::Instruction){0x08, 3, Core6502::PHP};
-    instructions[0x68] = (Core6502::Instruction){0x68, 4, Core6502::PLA};
-    instructions[0x28] = (Core6502::Instruction){0x28, 4, Core6502::PLP};
-
-    // Break/RTI
-    instructions[0x00] = (Core6502::Instruction){0x00, 7, Core6502::BRK};
-    instructions[0x40] = (Core6502::Instruction){0x40, 6, Core6502::RTI};
-
-    // Misc.
-    instructions[0xEA] = (Core6502::Instruction){0xEA, 2, Core6502::NOP};
-
-}
\ No newline at end of file
@@ -0,0 +1,504 @@
+//
+//  Core6502Batch.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include <string.h>
+#include "Core6502.hpp"
+#include "Core6502Batch.hpp"
+#include "Core6502OperationTemplates.hpp"
+#include "Core6502Flags.hpp"
+
+// Loops over every lane of a group.  Fixed trip count and plain arrays so they vectorize.
+#define CORE6502_LANES for (int i = 0; i < Core6502::Batch::Width; i++)
+
+static const uint8_t instructionCycles[0x100] = {
+#define CORE6502_OPCODE(opCode, cycles, operation, addressing) cycles,
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+};
+
+// Registers and flags of Width lanes.  N/Z/C/V are kept the way Flags::Lazy keeps them, so
+// kernels only store bytes; P holds the rest of status.
+struct Core6502::Batch::Group {
+    uint8_t A[Width];
+    uint8_t X[Width];
+    uint8_t Y[Width];
+    uint8_t SP[Width];
+    uint8_t P[Width];
+    uint8_t N[Width];           // Bit 7 is N
+    uint8_t Z[Width];           // Z when 0
+    uint8_t C[Width];
+    uint8_t V[Width];
+    uint16_t PC[Width];
+    uint32_t elapsed[Width];    // Cycles run this call
+
+    // Kernel scratch
+    uint8_t opCode[Width];
+    uint8_t value[Width];       // Operand value
+    uint8_t taken[Width];       // Branch condition
+    uint8_t extra[Width];       // Page crossing and taken branch cycles
+    uint16_t address[Width];    // Effective address
+
+    bool drained[Width];        // Lane's budget went on an instruction already in progress
+    bool fetched[Width];        // opCode holds the lane's next opcode, so it isn't read twice
+    Core6502::CPU * cpus[Width];
+    int count;
+};
+
+Core6502::Batch::Batch() {
+
+    lanes = 0;
+    lockstepInstructions = 0;
+    scalarInstructions = 0;
+
+}
+
+Core6502::Batch::~Batch() {
+
+    for (size_t i = 0; i < groups.size(); i++) delete groups[i];
+
+}
+
+size_t Core6502::Batch::add(Core6502::CPU & cpu) {
+
+    if (lanes % Width == 0) {
+        Group * group = new Group();
+        memset(group, 0, sizeof(Group));
+        groups.push_back(group);
+    }
+
+    Group & group = *groups.back();
+    group.cpus[group.count++] = &cpu;
+
+    return lanes++;
+
+}
+
+size_t Core6502::Batch::size() const {
+    return lanes;
+}
+
+uint64_t Core6502::Batch::run(uint32_t cycles) {
+
+    uint64_t instructions = 0;
+
+    for (size_t i = 0; i < groups.size(); i++)
+        instructions += runGroup(*groups[i], cycles);
+
+    return instructions;
+
+}
+
+uint64_t Core6502::Batch::runGroup(Core6502::Batch::Group & group, uint32_t cycles) {
+
+    uint64_t before = lockstepInstructions + scalarInstructions;
+
+    // Gather lanes, draining partially clocked instructions as CPU::run does.  Unused lanes
+    // count as finished.
+    CORE6502_LANES group.elapsed[i] = cycles;
+
+    for (int i = 0; i < group.count; i++) {
+
+        Core6502::CPU & cpu = *group.cpus[i];
+
+        group.drained[i] = cpu.cyclesRemaining >= cycles;
+        if (group.drained[i]) {
+            cpu.cyclesRemaining -= cycles;
+            cpu.totalCycles += cycles;
+            continue;
+        }
+
+        group.elapsed[i] = cpu.cyclesRemaining;
+        group.fetched[i] = false;
+        cpu.cyclesRemaining = 0;
+
+        group.PC[i] = cpu.registers.PC;
+        group.SP[i] = cpu.registers.SP;
+        group.A[i] = cpu.registers.A;
+        group.X[i] = cpu.registers.X;
+        group.Y[i] = cpu.registers.Y;
+        group.P[i] = cpu.status.raw;
+
+        Core6502::Flags::Lazy::load(cpu);
+        group.N[i] = cpu.lazyFlags.negative;
+        group.Z[i] = cpu.lazyFlags.zero;
+        group.C[i] = cpu.lazyFlags.carry;
+        group.V[i] = cpu.lazyFlags.overflow;
+
+    }
+
+    for (;;) {
+
+        // Fetch every active lane's opcode, once per instruction however long the lane waits
+        int active = 0;
+        bool same = true;
+        uint16_t lowest = 0xFFFF;
+
+        for (int i = 0; i < group.count; i++) {
+            if (group.elapsed[i] >= cycles) continue;
+
+            if (!group.fetched[i]) {
+                group.opCode[i] = group.cpus[i]->read(group.PC[i]);
+                group.fetched[i] = true;
+            }
+            same = same && group.opCode[i] == group.opCode[0];
+            if (group.PC[i] < lowest) lowest = group.PC[i];
+            active++;
+        }
+
+        if (!active) break;
+
+        // Whole group at one opcode
+        if (active == group.count && same && lockstep(group, group.opCode[0])) {
+            CORE6502_LANES group.fetched[i] = false;
+            continue;
+        }
+
+        // Diverged.  Step the lanes furthest behind so the others can wait for them.
+        for (int i = 0; i < group.count; i++)
+            if (group.elapsed[i] < cycles && group.PC[i] == lowest) scalar(group, i);
+
+    }
+
+    // Scatter lanes back, carrying overshoot as CPU::run does
+    for (int i = 0; i < group.count; i++) {
+
+        if (group.drained[i]) continue;
+
+        Core6502::CPU & cpu = *group.cpus[i];
+
+        cpu.registers.PC = group.PC[i];
+        cpu.registers.SP = group.SP[i];
+        cpu.registers.A = group.A[i];
+        cpu.registers.X = group.X[i];
+        cpu.registers.Y = group.Y[i];
+        cpu.status.raw = group.P[i];
+
+        cpu.lazyFlags.negative = group.N[i];
+        cpu.lazyFlags.zero = group.Z[i];
+        cpu.lazyFlags.carry = group.C[i];
+        cpu.lazyFlags.overflow = group.V[i];
+        Core6502::Flags::Lazy::store(cpu);
+
+        cpu.cyclesRemaining = group.elapsed[i] - cycles;
+        cpu.totalCycles += cycles;
+
+    }
+
+    return lockstepInstructions + scalarInstructions - before;
+
+}
+
+void Core6502::Batch::scalar(Core6502::Batch::Group & group, int lane) {
+
+    Core6502::CPU & cpu = *group.cpus[lane];
+
+    cpu.registers.PC = group.PC[lane];
+    cpu.registers.SP = group.SP[lane];
+    cpu.registers.A = group.A[lane];
+    cpu.registers.X = group.X[lane];
+    cpu.registers.Y = group.Y[lane];
+    cpu.status.raw = group.P[lane];
+
+    cpu.lazyFlags.negative = group.N[lane];
+    cpu.lazyFlags.zero = group.Z[lane];
+    cpu.lazyFlags.carry = group.C[lane];
+    cpu.lazyFlags.overflow = group.V[lane];
+    Core6502::Flags::Lazy::store(cpu);
+
+    // The opcode was read when the lane was fetched, reading it again would hit I/O twice
+    uint8_t opCode = group.opCode[lane];
+    group.fetched[lane] = false;
+    cpu.registers.PC++;
+    Core6502::specializedOperations[opCode](cpu);
+    group.elapsed[lane] += instructionCycles[opCode] + cpu.extraCycles;
+    cpu.extraCycles = 0;
+
+    group.PC[lane] = cpu.registers.PC;
+    group.SP[lane] = cpu.registers.SP;
+    group.A[lane] = cpu.registers.A;
+    group.X[lane] = cpu.registers.X;
+    group.Y[lane] = cpu.registers.Y;
+    group.P[lane] = cpu.status.raw;
+
+    Core6502::Flags::Lazy::load(cpu);
+    group.N[lane] = cpu.lazyFlags.negative;
+    group.Z[lane] = cpu.lazyFlags.zero;
+    group.C[lane] = cpu.lazyFlags.carry;
+    group.V[lane] = cpu.lazyFlags.overflow;
+
+    scalarInstructions++;
+
+}
+
+// Operand fetch.  Code and data bytes come from each lane's own bus, PC math is vectorized.
+
+static void implied(Core6502::Batch::Group & g) {
+    CORE6502_LANES g.PC[i] += 1;
+}
+
+static void immediate(Core6502::Batch::Group & g) {
+    for (int i = 0; i < g.count; i++) g.value[i] = g.cpus[i]->read(g.PC[i] + 1);
+    CORE6502_LANES g.PC[i] += 2;
+}
+
+static void zeroPage(Core6502::Batch::Group & g) {
+    for (int i = 0; i < g.count; i++) g.address[i] = g.cpus[i]->read(g.PC[i] + 1);
+    CORE6502_LANES g.PC[i] += 2;
+}
+
+static void zeroPageX(Core6502::Batch::Group & g) {
+    zeroPage(g);
+    CORE6502_LANES g.address[i] = (uint8_t)(g.address[i] + g.X[i]);
+}
+
+static void absolute(Core6502::Batch::Group & g) {
+    for (int i = 0; i < g.count; i++)
+        g.address[i] = g.cpus[i]->read(g.PC[i] + 1) | (g.cpus[i]->read(g.PC[i] + 2) << 8);
+    CORE6502_LANES g.PC[i] += 3;
+}
+
+static void absoluteX(Core6502::Batch::Group & g) {
+    absolute(g);
+    CORE6502_LANES g.address[i] += g.X[i];
+}
+
+static void absoluteY(Core6502::Batch::Group & g) {
+    absolute(g);
+    CORE6502_LANES g.address[i] += g.Y[i];
+}
+
+// Indexed reads take a cycle more when the index carried into the high byte
+static void crossed(Core6502::Batch::Group & g, const uint8_t * index) {
+    CORE6502_LANES g.extra[i] = (uint8_t)g.address[i] < index[i];
+}
+
+static void readValue(Core6502::Batch::Group & g) {
+    for (int i = 0; i < g.count; i++) g.value[i] = g.cpus[i]->read(g.address[i]);
+}
+
+// Kernels, matching the operation templates including their quirks
+
+static void load(Core6502::Batch::Group & g, uint8_t * reg) {
+    CORE6502_LANES {
+        reg[i] = g.value[i];
+        g.N[i] = g.Z[i] = reg[i];
+    }
+}
+
+static void storeA(Core6502::Batch::Group & g) {
+    // STA sets N/Z from A
+    for (int i = 0; i < g.count; i++) g.cpus[i]->write(g.address[i], g.A[i]);
+    CORE6502_LANES g.N[i] = g.Z[i] = g.A[i];
+}
+
+static void storeX(Core6502::Batch::Group & g) {
+    // STX only keeps the low byte of its address, and sets N/Z from X
+    for (int i = 0; i < g.count; i++) g.cpus[i]->write((uint8_t)g.address[i], g.X[i]);
+    CORE6502_LANES g.N[i] = g.Z[i] = g.X[i];
+}
+
+static void modify(Core6502::Batch::Group & g, uint8_t delta) {
+    // INC/DEC read, compute across lanes, then write
+    readValue(g);
+    CORE6502_LANES {
+        g.value[i] += delta;
+        g.N[i] = g.Z[i] = g.value[i];
+    }
+    for (int i = 0; i < g.count; i++) g.cpus[i]->write(g.address[i], g.value[i]);
+}
+
+static void andA(Core6502::Batch::Group & g) {
+    CORE6502_LANES {
+        g.A[i] &= g.value[i];
+        g.N[i] = g.Z[i] = g.A[i];
+    }
+}
+
+static void orA(Core6502::Batch::Group & g) {
+    CORE6502_LANES {
+        g.A[i] |= g.value[i];
+        g.N[i] = g.Z[i] = g.A[i];
+    }
+}
+
+static void eorA(Core6502::Batch::Group & g) {
+    CORE6502_LANES {
+        g.A[i] ^= g.value[i];
+        g.N[i] = g.Z[i] = g.A[i];
+    }
+}
+
+// Any lane in decimal mode
+static bool decimal(const Core6502::Batch::Group & g) {
+    bool any = false;
+    for (int i = 0; i < g.count; i++) any = any || (g.P[i] & 0x08);
+    return any;
+}
+
+static void adc(Core6502::Batch::Group & g) {
+    CORE6502_LANES {
+        uint16_t tmp = g.A[i] + g.value[i] + g.C[i];
+        g.C[i] = tmp >> 8;
+        g.V[i] = ((g.A[i] ^ tmp) & (g.value[i] ^ tmp) & 0x80) >> 7;
+        g.A[i] = (uint8_t)tmp;
+        g.N[i] = g.Z[i] = g.A[i];
+    }
+}
+
+static void shiftA(Core6502::Batch::Group & g, bool left, bool rotate) {
+    CORE6502_LANES {
+        uint8_t in = rotate ? g.C[i] : 0;
+        uint8_t out = left ? g.A[i] >> 7 : g.A[i] & 0x01;
+        g.A[i] = left ? (g.A[i] << 1) | in : (g.A[i] >> 1) | (in << 7);
+        g.C[i] = out;
+        g.N[i] = g.Z[i] = g.A[i];
+    }
+    // ASL never sets N
+    if (left && !rotate) CORE6502_LANES g.N[i] = 0;
+}
+
+static void compare(Core6502::Batch::Group & g, const uint8_t * reg) {
+    CORE6502_LANES {
+        g.C[i] = reg[i] >= g.value[i];
+        g.N[i] = g.Z[i] = (uint8_t)(reg[i] - g.value[i]);
+    }
+}
+
+static void increment(Core6502::Batch::Group & g, uint8_t * reg, uint8_t delta) {
+    CORE6502_LANES {
+        reg[i] += delta;
+        g.N[i] = g.Z[i] = reg[i];
+    }
+}
+
+static void transfer(Core6502::Batch::Group & g, const uint8_t * from, uint8_t * to) {
+    CORE6502_LANES {
+        to[i] = from[i];
+        g.N[i] = g.Z[i] = to[i];
+    }
+}
+
+static void branch(Core6502::Batch::Group & g) {
+    // Offset is relative to the following instruction.  Taken costs a cycle more, and another
+    // landing on a different page.
+    immediate(g);
+    CORE6502_LANES {
+        uint16_t target = g.PC[i] + (int8_t)g.value[i];
+        g.extra[i] = g.taken[i] * (1 + (((g.PC[i] ^ target) >> 8) != 0));
+        g.PC[i] = g.taken[i] ? target : g.PC[i];
+    }
+}
+
+bool Core6502::Batch::lockstep(Core6502::Batch::Group & g, uint8_t opCode) {
+
+    // Decimal mode ADC is left to the templates
+    if ((opCode == 0x69 || opCode == 0x65 || opCode == 0x6D) && decimal(g)) return false;
+
+    switch (opCode) {
+
+        // Loads
+        case 0xA9: immediate(g); load(g, g.A); break;                   // LDA #
+        case 0xA5: zeroPage(g); readValue(g); load(g, g.A); break;      // LDA zp
+        case 0xB5: zeroPageX(g); readValue(g); load(g, g.A); break;     // LDA zp,X
+        case 0xAD: absolute(g); readValue(g); load(g, g.A); break;      // LDA abs
+        case 0xBD: absoluteX(g); crossed(g, g.X); readValue(g); load(g, g.A); break;    // LDA abs,X
+        case 0xB9: absoluteY(g); crossed(g, g.Y); readValue(g); load(g, g.A); break;    // LDA abs,Y
+        case 0xA2: immediate(g); load(g, g.X); break;                   // LDX #
+        case 0xA6: zeroPage(g); readValue(g); load(g, g.X); break;      // LDX zp
+        case 0xAE: absolute(g); readValue(g); load(g, g.X); break;      // LDX abs
+        case 0xA0: immediate(g); load(g, g.Y); break;                   // LDY #
+        case 0xA4: zeroPage(g); readValue(g); load(g, g.Y); break;      // LDY zp
+        case 0xAC: absolute(g); readValue(g); load(g, g.Y); break;      // LDY abs
+
+        // Stores
+        case 0x85: zeroPage(g); storeA(g); break;                       // STA zp
+        case 0x95: zeroPageX(g); storeA(g); break;                      // STA zp,X
+        case 0x8D: absolute(g); storeA(g); break;                       // STA abs
+        case 0x9D: absoluteX(g); storeA(g); break;                      // STA abs,X
+        case 0x99: absoluteY(g); storeA(g); break;                      // STA abs,Y
+
+        case 0x86: zeroPage(g); storeX(g); break;                       // STX zp
+        case 0x8E: absolute(g); storeX(g); break;                       // STX abs
+
+        // Logic & arithmetic
+        case 0x29: immediate(g); andA(g); break;                        // AND #
+        case 0x25: zeroPage(g); readValue(g); andA(g); break;           // AND zp
+        case 0x2D: absolute(g); readValue(g); andA(g); break;           // AND abs
+        case 0x09: immediate(g); orA(g); break;                         // ORA #
+        case 0x05: zeroPage(g); readValue(g); orA(g); break;            // ORA zp
+        case 0x0D: absolute(g); readValue(g); orA(g); break;            // ORA abs
+        case 0x49: immediate(g); eorA(g); break;                        // EOR #
+        case 0x45: zeroPage(g); readValue(g); eorA(g); break;           // EOR zp
+        case 0x4D: absolute(g); readValue(g); eorA(g); break;           // EOR abs
+        case 0x69: immediate(g); adc(g); break;                         // ADC #
+        case 0x65: zeroPage(g); readValue(g); adc(g); break;            // ADC zp
+        case 0x6D: absolute(g); readValue(g); adc(g); break;            // ADC abs
+
+        // Compares
+        case 0xC9: immediate(g); compare(g, g.A); break;                // CMP #
+        case 0xC5: zeroPage(g); readValue(g); compare(g, g.A); break;   // CMP zp
+        case 0xCD: absolute(g); readValue(g); compare(g, g.A); break;   // CMP abs
+        case 0xE0: immediate(g); compare(g, g.X); break;                // CPX #
+        case 0xE4: zeroPage(g); readValue(g); compare(g, g.X); break;   // CPX zp
+        case 0xEC: absolute(g); readValue(g); compare(g, g.X); break;   // CPX abs
+        case 0xC0: immediate(g); compare(g, g.Y); break;                // CPY #
+        case 0xC4: zeroPage(g); readValue(g); compare(g, g.Y); break;   // CPY zp
+        case 0xCC: absolute(g); readValue(g); compare(g, g.Y); break;   // CPY abs
+
+        // Shifts & read-modify-write
+        case 0x0A: implied(g); shiftA(g, true, false); break;           // ASL A
+        case 0x4A: implied(g); shiftA(g, false, false); break;          // LSR A
+        case 0x2A: implied(g); shiftA(g, true, true); break;            // ROL A
+        case 0x6A: implied(g); shiftA(g, false, true); break;           // ROR A
+        case 0xE6: zeroPage(g); modify(g, 1); break;                    // INC zp
+        case 0xEE: absolute(g); modify(g, 1); break;                    // INC abs
+        case 0xC6: zeroPage(g); modify(g, 0xFF); break;                 // DEC zp
+        case 0xCE: absolute(g); modify(g, 0xFF); break;                 // DEC abs
+
+        // Register increments and transfers
+        case 0xE8: implied(g); increment(g, g.X, 1); break;             // INX
+        case 0xC8: implied(g); increment(g, g.Y, 1); break;             // INY
+        case 0xCA: implied(g); increment(g, g.X, 0xFF); break;          // DEX
+        case 0x88: implied(g); increment(g, g.Y, 0xFF); break;          // DEY
+        case 0xAA: implied(g); transfer(g, g.A, g.X); break;            // TAX
+        case 0xA8: implied(g); transfer(g, g.A, g.Y); break;            // TAY
+        case 0x8A: implied(g); transfer(g, g.X, g.A); break;            // TXA
+        case 0x98: implied(g); transfer(g, g.Y, g.A); break;            // TYA
+
+        // Flags
+        case 0x18: implied(g); CORE6502_LANES g.C[i] = 0; break;        // CLC
+        case 0x38: implied(g); CORE6502_LANES g.C[i] = 1; break;        // SEC
+        case 0xB8: implied(g); CORE6502_LANES g.V[i] = 0; break;        // CLV
+        case 0xEA: implied(g); break;                                   // NOP
+
+        // Branches & jumps
+        case 0x10: CORE6502_LANES g.taken[i] = !(g.N[i] & 0x80); branch(g); break;  // BPL
+        case 0x30: CORE6502_LANES g.taken[i] = g.N[i] >> 7; branch(g); break;       // BMI
+        case 0x50: CORE6502_LANES g.taken[i] = !g.V[i]; branch(g); break;           // BVC
+        case 0x70: CORE6502_LANES g.taken[i] = g.V[i]; branch(g); break;            // BVS
+        case 0x90: CORE6502_LANES g.taken[i] = !g.C[i]; branch(g); break;           // BCC
+        case 0xB0: CORE6502_LANES g.taken[i] = g.C[i]; branch(g); break;            // BCS
+        case 0xD0: CORE6502_LANES g.taken[i] = g.Z[i] != 0; branch(g); break;       // BNE
+        case 0xF0: CORE6502_LANES g.taken[i] = g.Z[i] == 0; branch(g); break;       // BEQ
+        case 0x4C: absolute(g); CORE6502_LANES g.PC[i] = g.address[i]; break;       // JMP abs
+
+        default:
+            return false;
+
+    }
+
+    uint8_t cycles = instructionCycles[opCode];
+    CORE6502_LANES {
+        g.elapsed[i] += cycles + g.extra[i];
+        g.extra[i] = 0;
+    }
+
+    lockstepInstructions += g.count;
+
+    return true;
+
+}
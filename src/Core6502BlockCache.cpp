@@ -0,0 +1,283 @@
+//
+//  Core6502BlockCache.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include <string.h>
+#include "Core6502.hpp"
+#include "Core6502BlockCache.hpp"
+#include "Core6502OperationTemplates.hpp"
+#include "Core6502Flags.hpp"
+#include "Core6502Trace.hpp"
+#include "Core6502Profiler.hpp"
+
+// Pages invalidated more often than this are left to the switch core until the next flush
+#define CORE6502_MAX_PAGE_REWRITES 64
+
+// Instruction length and cycles per opcode
+static const uint8_t instructionLength[0x100] = {
+#define CORE6502_OPCODE(opCode, cycles, operation, addressing) CORE6502_ADDRESSING_LENGTH_##addressing,
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+};
+
+static const uint8_t instructionCycles[0x100] = {
+#define CORE6502_OPCODE(opCode, cycles, operation, addressing) cycles,
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+};
+
+// Most cycles an instruction can take, with a page crossing or a taken branch
+static const uint8_t instructionMaxCycles[0x100] = {
+#define CORE6502_OPCODE(opCode, cycles, operation, addressing) cycles + 2 * CORE6502_ADDRESSING_VARIABLE_##addressing,
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+};
+
+// Predecoded operation per opcode, in the cached core's flag mode
+#define CORE6502_OPCODE(opCode, cycles, operation, addressing) \
+    static void decoded_##opCode(Core6502::CPU& cpu, uint16_t operand) { \
+        Core6502::operation<CORE6502_ADDRESSING_DECODED_##addressing, CORE6502_FLAGS>( \
+            cpu, CORE6502_ADDRESSING_DECODED_##addressing(operand)); \
+    }
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+
+static void (* const cachedOperations[0x100])(Core6502::CPU&, uint16_t) = {
+#define CORE6502_OPCODE(opCode, cycles, operation, addressing) decoded_##opCode,
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+};
+
+// Instructions that can leave PC anywhere other than the next instruction
+static bool endsBlock(uint8_t opCode) {
+
+    switch (opCode) {
+        case 0x00:                          // BRK
+        case 0x20:                          // JSR
+        case 0x40:                          // RTI
+        case 0x60:                          // RTS
+        case 0x4C: case 0x6C:               // JMP
+        case 0x10: case 0x30: case 0x50: case 0x70:
+        case 0x90: case 0xB0: case 0xD0: case 0xF0:     // Branches
+            return true;
+        default:
+            return false;
+    }
+
+}
+
+Core6502::BlockCache::BlockCache(Core6502::Bus & bus) : bus(bus) {
+
+    lines = new Block[Lines];
+    trap = bus.addWriteTrap(codeWritten, this);
+
+    for (int i = 0; i < 0x100; i++) pageGeneration[i] = 0;
+
+    hits = 0;
+    misses = 0;
+
+    flush();
+
+}
+
+Core6502::BlockCache::~BlockCache() {
+
+    if (trap >= 0) bus.removeWriteTrap(trap);
+    delete [] lines;
+
+}
+
+void Core6502::BlockCache::flush() {
+
+    for (int i = 0; i < Lines; i++) lines[i].count = 0;
+
+    for (int page = 0; page < 0x100; page++) {
+        if (trap >= 0) bus.untrapPage(trap, page);
+        pageRewrites[page] = 0;
+    }
+
+    mapGeneration = bus.mapGeneration;
+    invalidated = true;
+
+}
+
+bool Core6502::BlockCache::cacheable(uint8_t page) const {
+
+    // I/O pages can change under us without a write, and we need a trap slot to notice writes
+    return bus.readPage[page] && trap >= 0 && pageRewrites[page] < CORE6502_MAX_PAGE_REWRITES;
+
+}
+
+const Core6502::BlockCache::Block & Core6502::BlockCache::lookup(uint16_t pc) {
+
+    // Any remap may have changed what's behind cached code
+    if (bus.mapGeneration != mapGeneration) flush();
+
+    Block & block = lines[(pc ^ (pc >> 9)) & (Lines - 1)];
+
+    if (block.count && block.start == pc &&
+        block.generation[0] == pageGeneration[block.pages[0]] &&
+        block.generation[1] == pageGeneration[block.pages[1]]) {
+        hits++;
+        return block;
+    }
+
+    misses++;
+    decode(block, pc);
+
+    return block;
+
+}
+
+void Core6502::BlockCache::decode(Block & block, uint16_t pc) {
+
+    block.start = pc;
+    block.count = 0;
+    block.cycles = 0;
+    block.idle = false;
+
+    uint16_t addr = pc;
+    bool sideEffects = false;
+
+    // At most 3 bytes per instruction, so a block covers no more than two pages
+    while (block.count < MaxBlockLength && cacheable(addr >> 8)) {
+
+        uint8_t opCode = bus.read(addr);
+        uint8_t length = instructionLength[opCode];
+        if (!cacheable((uint16_t)(addr + length - 1) >> 8)) break;
+
+        uint16_t operand = 0;
+        if (length > 1) operand  = bus.read(addr + 1);
+        if (length > 2) operand |= bus.read(addr + 2) << 8;
+
+        DecodedInstruction & inst = block.instructions[block.count++];
+        inst.operation = cachedOperations[opCode];
+        inst.operand = operand;
+        inst.next = addr + length;
+        inst.cycles = instructionCycles[opCode];
+
+        block.cycles += instructionMaxCycles[opCode];
+        addr += length;
+
+        if (!Core6502::CPU::sideEffectFree(opCode)) sideEffects = true;
+
+        if (endsBlock(opCode)) {
+            // A loop of one block, the only kind the cached core looks at for skipping
+            bool jumpsToStart = opCode == 0x4C ? operand == pc :
+                (opCode & 0x1F) == 0x10 && (uint16_t)(addr + (int8_t)operand) == pc;
+            block.idle = jumpsToStart && !sideEffects;
+            break;
+        }
+
+    }
+
+    block.end = addr;
+    if (!block.count) return;
+
+    // Watch the code's pages for writes
+    block.pages[0] = pc >> 8;
+    block.pages[1] = (uint16_t)(addr - 1) >> 8;
+
+    for (int i = 0; i < 2; i++) {
+        block.generation[i] = pageGeneration[block.pages[i]];
+        bus.trapPage(trap, block.pages[i]);
+    }
+
+}
+
+void Core6502::BlockCache::codeWritten(void * context, uint16_t addr, uint8_t value) {
+
+    Core6502::BlockCache & cache = *(Core6502::BlockCache *)context;
+    uint8_t page = addr >> 8;
+
+    // Orphan every block on the page.  The trap comes back once code there is decoded again.
+    cache.pageGeneration[page]++;
+    if (cache.pageRewrites[page] < CORE6502_MAX_PAGE_REWRITES) cache.pageRewrites[page]++;
+    cache.bus.untrapPage(cache.trap, page);
+
+    cache.invalidated = true;
+
+}
+
+uint32_t Core6502::CPU::runCached(uint32_t cycles, int32_t stopPC, bool (*predicate)(Core6502::CPU&)) {
+
+    uint32_t elapsed = 0;
+
+    CORE6502_FLAGS::load(*this);
+    CORE6502_TRACE_ATTACHED(tracer, *this)
+    CORE6502_PROFILE_ATTACHED(profile, *this)
+    bool skipping = idleSkipping && !predicate && !CORE6502_TRACING(*this) && !CORE6502_PROFILING(*this);
+
+    // Set when the predicate fired inside a block, so it isn't asked again at the same boundary
+    bool stopped = false;
+
+    while (!stopped && elapsed < cycles && registers.PC != stopPC &&
+           !(predicate && Core6502::Flags::observe<CORE6502_FLAGS>(*this, predicate))) {
+
+        const Core6502::BlockCache::Block & block = blockCache->lookup(registers.PC);
+
+        // Uncacheable code runs an instruction at a time
+        if (!block.count) {
+            CORE6502_FLAGS::store(*this);
+            CORE6502_TRACE_BASE(*this, trace->base + elapsed)
+            CORE6502_PROFILE_BASE(*this, profiler->base + elapsed)
+            uint32_t used = interpret(1, -1, NULL);
+            CORE6502_TRACE_BASE(*this, trace->base - elapsed)
+            CORE6502_PROFILE_BASE(*this, profiler->base - elapsed)
+            elapsed += used;
+            CORE6502_FLAGS::load(*this);
+            continue;
+        }
+
+        // Stop conditions only need checking inside blocks that could end the run early
+        bool checked = predicate || elapsed + block.cycles > cycles ||
+            (stopPC >= 0 && (uint16_t)(stopPC - block.start) < (uint16_t)(block.end - block.start));
+
+        const Core6502::BlockCache::DecodedInstruction * inst = block.instructions;
+        const Core6502::BlockCache::DecodedInstruction * last = inst + block.count - 1;
+
+        blockCache->invalidated = false;
+
+        // A block that loops on itself gets one pass to show it changes nothing (see skipIdle())
+        bool idle = skipping && block.idle;
+        decltype(registers) before = registers;
+        uint8_t statusBefore = idle ? CORE6502_FLAGS::raw(*this) : 0;
+        uint32_t reads = bus.slowReads;
+        uint32_t started = elapsed;
+
+        for (;;) {
+
+            CORE6502_TRACE_INSTRUCTION(tracer, *this, CORE6502_FLAGS::raw(*this), elapsed)
+            CORE6502_PROFILE_INSTRUCTION(profile, *this, elapsed)
+            registers.PC = inst->next;
+            inst->operation(*this, inst->operand);
+            elapsed += inst->cycles + extraCycles;
+            extraCycles = 0;
+
+            // Self modifying code drops the rest of the block
+            if (inst++ == last || blockCache->invalidated) break;
+            if (checked && (elapsed >= cycles || registers.PC == stopPC)) break;
+            if (predicate && Core6502::Flags::observe<CORE6502_FLAGS>(*this, predicate)) {
+                stopped = true;
+                break;
+            }
+
+        }
+
+        if (idle && elapsed < cycles && !blockCache->invalidated && bus.slowReads == reads &&
+            memcmp(&before, &registers, sizeof(registers)) == 0 && CORE6502_FLAGS::raw(*this) == statusBefore) {
+            uint32_t pass = elapsed - started;
+            uint32_t skipped = (cycles - elapsed) / pass * pass;
+            idleCyclesSkipped += skipped;
+            elapsed += skipped;
+        }
+
+    }
+
+    CORE6502_FLAGS::store(*this);
+    return elapsed;
+
+}
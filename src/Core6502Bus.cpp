@@ -0,0 +1,226 @@
+//
+//  Core6502Bus.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include "Core6502Bus.hpp"
+
+// Returns the number of pages covered by [start, start + length)
+static inline uint32_t pageCount(uint16_t start, uint32_t length) {
+
+    uint32_t first = start >> 8;
+    uint32_t last = (start + length + 0xFF) >> 8;
+
+    if (last > 0x100) last = 0x100;
+    return last > first ? last - first : 0;
+
+}
+
+Core6502::Bus::Bus() {
+
+    mapGeneration = 0;
+    slowReads = 0;
+    input = NULL;
+    inputContext = NULL;
+
+    for (int i = 0; i < MaxWriteTraps; i++) traps[i] = (Trap){NULL, NULL};
+    for (int i = 0; i < MaxReadTraps; i++) readTraps[i] = (Trap){NULL, NULL};
+    for (int i = 0; i < 0x100; i++) trapMask[i] = readTrapMask[i] = 0;
+
+    unmap(0x0000, 0x10000);
+
+}
+
+void Core6502::Bus::setPage(uint32_t page, uint8_t * read, uint8_t * write, const Handler & handler) {
+
+    directReadPage[page] = read;
+    directWritePage[page] = write;
+    handlers[page] = handler;
+
+    // Trapped pages keep sending accesses down the slow path
+    readPage[page] = readTrapMask[page] ? NULL : read;
+    writePage[page] = trapMask[page] ? NULL : write;
+
+}
+
+uint8_t Core6502::Bus::readSlow(uint16_t addr) {
+
+    slowReads++;
+
+    uint8_t page = addr >> 8;
+    uint8_t value = 0;
+
+    Handler & handler = handlers[page];
+    if (directReadPage[page]) value = directReadPage[page][addr & 0xFF];
+    else if (input) value = input(inputContext, addr, handler);
+    else if (handler.read) value = handler.read(handler.context, addr);
+
+    // Report to read traps once the value is known.  The mask is read again every time, a
+    // trap may remove another while handling this.
+    for (int i = 0; readTrapMask[page] >> i; i++) {
+        if ((readTrapMask[page] >> i) & 1) readTraps[i].callback(readTraps[i].context, addr, value);
+    }
+
+    return value;
+
+}
+
+void Core6502::Bus::writeSlow(uint16_t addr, uint8_t value) {
+
+    uint8_t page = addr >> 8;
+
+    // Report to traps first.  A trap may remove itself or another from the page while
+    // handling this, so the mask is read again every time.
+    for (int i = 0; trapMask[page] >> i; i++) {
+        if ((trapMask[page] >> i) & 1) traps[i].callback(traps[i].context, addr, value);
+    }
+
+    if (directWritePage[page]) {
+        directWritePage[page][addr & 0xFF] = value;
+        return;
+    }
+
+    Handler & handler = handlers[page];
+    if (handler.write) handler.write(handler.context, addr, value);
+
+}
+
+void Core6502::Bus::mapRAM(uint16_t start, uint32_t length, uint8_t * data) {
+
+    uint32_t first = start >> 8;
+    uint32_t count = pageCount(start, length);
+
+    for (uint32_t i = 0; i < count; i++)
+        setPage(first + i, data + (i << 8), data + (i << 8), (Handler){NULL, NULL, NULL});
+
+    mapGeneration++;
+
+}
+
+void Core6502::Bus::mapROM(uint16_t start, uint32_t length, const uint8_t * data) {
+
+    uint32_t first = start >> 8;
+    uint32_t count = pageCount(start, length);
+
+    // Writes fall through to a handler without a write callback and are dropped
+    for (uint32_t i = 0; i < count; i++)
+        setPage(first + i, (uint8_t *)data + (i << 8), NULL, (Handler){NULL, NULL, NULL});
+
+    mapGeneration++;
+
+}
+
+void Core6502::Bus::mapIO(uint16_t start, uint32_t length, BusReadCallback read, BusWriteCallback write, void * context) {
+
+    uint32_t first = start >> 8;
+    uint32_t count = pageCount(start, length);
+
+    for (uint32_t i = 0; i < count; i++)
+        setPage(first + i, NULL, NULL, (Handler){read, write, context});
+
+    mapGeneration++;
+
+}
+
+void Core6502::Bus::mirror(uint16_t start, uint32_t length, uint16_t source) {
+
+    uint32_t first = start >> 8;
+    uint32_t count = pageCount(start, length);
+    uint32_t from = source >> 8;
+
+    // Copy page entries, wrapping around the source region if it's smaller than the mirror
+    uint32_t span = first > from ? first - from : 0x100;
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t src = (from + (i % span)) & 0xFF;
+        setPage(first + i, directReadPage[src], directWritePage[src], handlers[src]);
+    }
+
+    mapGeneration++;
+
+}
+
+void Core6502::Bus::unmap(uint16_t start, uint32_t length) {
+    mapIO(start, length, NULL, NULL, NULL);
+}
+
+int Core6502::Bus::addWriteTrap(BusWriteCallback callback, void * context) {
+
+    for (int i = 0; i < MaxWriteTraps; i++) {
+        if (!traps[i].callback) {
+            traps[i] = (Trap){callback, context};
+            return i;
+        }
+    }
+
+    return -1;
+
+}
+
+void Core6502::Bus::removeWriteTrap(int trap) {
+
+    for (int page = 0; page < 0x100; page++) untrapPage(trap, page);
+    traps[trap] = (Trap){NULL, NULL};
+
+}
+
+void Core6502::Bus::trapPage(int trap, uint8_t page) {
+
+    trapMask[page] |= (1 << trap);
+    writePage[page] = NULL;
+
+}
+
+void Core6502::Bus::untrapPage(int trap, uint8_t page) {
+
+    trapMask[page] &= ~(1 << trap);
+    if (!trapMask[page]) writePage[page] = directWritePage[page];
+
+}
+
+void Core6502::Bus::invalidatePage(uint8_t page) {
+
+    uint16_t addr = page << 8;
+    uint8_t value = directReadPage[page] ? directReadPage[page][0] : 0;
+
+    for (int i = 0; trapMask[page] >> i; i++) {
+        if ((trapMask[page] >> i) & 1) traps[i].callback(traps[i].context, addr, value);
+    }
+
+}
+
+int Core6502::Bus::addReadTrap(BusWriteCallback callback, void * context) {
+
+    for (int i = 0; i < MaxReadTraps; i++) {
+        if (!readTraps[i].callback) {
+            readTraps[i] = (Trap){callback, context};
+            return i;
+        }
+    }
+
+    return -1;
+
+}
+
+void Core6502::Bus::removeReadTrap(int trap) {
+
+    for (int page = 0; page < 0x100; page++) untrapPageReads(trap, page);
+    readTraps[trap] = (Trap){NULL, NULL};
+
+}
+
+void Core6502::Bus::trapPageReads(int trap, uint8_t page) {
+
+    readTrapMask[page] |= (1 << trap);
+    readPage[page] = NULL;
+
+}
+
+void Core6502::Bus::untrapPageReads(int trap, uint8_t page) {
+
+    readTrapMask[page] &= ~(1 << trap);
+    if (!readTrapMask[page]) readPage[page] = directReadPage[page];
+
+}
@@ -0,0 +1,204 @@
+//
+//  Core6502Debugger.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include <string.h>
+#include "Core6502.hpp"
+#include "Core6502Debugger.hpp"
+
+Core6502::Debugger::Debugger(Core6502::CPU & cpu) : cpu(cpu) {
+
+    stopped = Stop::None;
+    address = 0;
+    access = 0;
+    hits = 0;
+
+    memset(breakpointMap, 0, sizeof(breakpointMap));
+    memset(pageBreakpoints, 0, sizeof(pageBreakpoints));
+    breakpoints = 0;
+
+    memset(readMap, 0, sizeof(readMap));
+    memset(writeMap, 0, sizeof(writeMap));
+    memset(pageReads, 0, sizeof(pageReads));
+    memset(pageWrites, 0, sizeof(pageWrites));
+    watchpoints = 0;
+
+    // Traps are registered up front but set on no pages until something is watched
+    readTrap = cpu.bus.addReadTrap(read, this);
+    writeTrap = cpu.bus.addWriteTrap(written, this);
+
+    predicate = NULL;
+    resuming = false;
+    watchHit = false;
+
+}
+
+Core6502::Debugger::~Debugger() {
+
+    if (readTrap >= 0) cpu.bus.removeReadTrap(readTrap);
+    if (writeTrap >= 0) cpu.bus.removeWriteTrap(writeTrap);
+
+}
+
+void Core6502::Debugger::addBreakpoint(uint16_t pc) {
+
+    if (test(breakpointMap, pc)) return;
+
+    breakpointMap[pc >> 3] |= 1 << (pc & 7);
+    pageBreakpoints[pc >> 8]++;
+    breakpoints++;
+
+}
+
+void Core6502::Debugger::removeBreakpoint(uint16_t pc) {
+
+    if (!test(breakpointMap, pc)) return;
+
+    breakpointMap[pc >> 3] &= ~(1 << (pc & 7));
+    pageBreakpoints[pc >> 8]--;
+    breakpoints--;
+
+}
+
+bool Core6502::Debugger::watch(uint8_t * map, uint16_t * pages, uint16_t addr, int trap, bool reads) {
+
+    if (test(map, addr)) return true;
+    if (trap < 0) return false;
+
+    map[addr >> 3] |= 1 << (addr & 7);
+    watchpoints++;
+
+    // First watchpoint on the page takes it off the fast path
+    if (!pages[addr >> 8]++) {
+        if (reads) cpu.bus.trapPageReads(trap, addr >> 8);
+        else cpu.bus.trapPage(trap, addr >> 8);
+    }
+
+    return true;
+
+}
+
+void Core6502::Debugger::unwatch(uint8_t * map, uint16_t * pages, uint16_t addr, int trap, bool reads) {
+
+    if (!test(map, addr)) return;
+
+    map[addr >> 3] &= ~(1 << (addr & 7));
+    watchpoints--;
+
+    // And the last one puts it back
+    if (!--pages[addr >> 8]) {
+        if (reads) cpu.bus.untrapPageReads(trap, addr >> 8);
+        else cpu.bus.untrapPage(trap, addr >> 8);
+    }
+
+}
+
+bool Core6502::Debugger::addWatchpoint(uint16_t addr, uint8_t access) {
+
+    if ((access & Read) && (readTrap < 0)) return false;
+    if ((access & Write) && (writeTrap < 0)) return false;
+
+    if (access & Read) watch(readMap, pageReads, addr, readTrap, true);
+    if (access & Write) watch(writeMap, pageWrites, addr, writeTrap, false);
+
+    return true;
+
+}
+
+void Core6502::Debugger::removeWatchpoint(uint16_t addr, uint8_t access) {
+
+    if (access & Read) unwatch(readMap, pageReads, addr, readTrap, true);
+    if (access & Write) unwatch(writeMap, pageWrites, addr, writeTrap, false);
+
+}
+
+uint8_t Core6502::Debugger::watchpoint(uint16_t addr) const {
+    return (test(readMap, addr) ? Read : 0) | (test(writeMap, addr) ? Write : 0);
+}
+
+void Core6502::Debugger::clear() {
+
+    memset(breakpointMap, 0, sizeof(breakpointMap));
+    memset(pageBreakpoints, 0, sizeof(pageBreakpoints));
+    breakpoints = 0;
+
+    for (int page = 0; page < 0x100; page++) {
+        if (pageReads[page]) cpu.bus.untrapPageReads(readTrap, page);
+        if (pageWrites[page]) cpu.bus.untrapPage(writeTrap, page);
+    }
+
+    memset(readMap, 0, sizeof(readMap));
+    memset(writeMap, 0, sizeof(writeMap));
+    memset(pageReads, 0, sizeof(pageReads));
+    memset(pageWrites, 0, sizeof(pageWrites));
+    watchpoints = 0;
+
+}
+
+bool Core6502::Debugger::begin(bool (*predicate)(Core6502::CPU&)) {
+
+    stopped = Stop::None;
+    if (!armed()) return false;
+
+    this->predicate = predicate;
+    resuming = true;
+    watchHit = false;
+
+    return true;
+
+}
+
+bool Core6502::Debugger::check(Core6502::CPU & cpu) {
+
+    Core6502::Debugger & debugger = *cpu.debugger;
+
+    // The instruction a run starts on has already been stopped at
+    bool resuming = debugger.resuming;
+    debugger.resuming = false;
+
+    // Cores may ask again at the boundary they stop on, so a stop stays true until the next run
+    if (debugger.watchHit) return true;
+
+    if (!resuming && debugger.breakpoint(cpu.registers.PC)) {
+        if (debugger.stopped != Stop::Breakpoint) {
+            debugger.stopped = Stop::Breakpoint;
+            debugger.address = cpu.registers.PC;
+            debugger.access = 0;
+            debugger.hits++;
+        }
+        return true;
+    }
+
+    return debugger.predicate && debugger.predicate(cpu);
+
+}
+
+void Core6502::Debugger::accessed(Core6502::Debugger & debugger, uint16_t addr, uint8_t access) {
+
+    // Traps stay on the bus while detached, a rewind replaying the past for one
+    if (debugger.cpu.debugger != &debugger) return;
+
+    debugger.watchHit = true;
+    debugger.stopped = Stop::Watchpoint;
+    debugger.address = addr;
+    debugger.access = access;
+    debugger.hits++;
+
+}
+
+void Core6502::Debugger::read(void * context, uint16_t addr, uint8_t value) {
+
+    Core6502::Debugger & debugger = *(Core6502::Debugger *)context;
+    if (test(debugger.readMap, addr)) accessed(debugger, addr, Read);
+
+}
+
+void Core6502::Debugger::written(void * context, uint16_t addr, uint8_t value) {
+
+    Core6502::Debugger & debugger = *(Core6502::Debugger *)context;
+    if (test(debugger.writeMap, addr)) accessed(debugger, addr, Write);
+
+}
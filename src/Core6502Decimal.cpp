@@ -0,0 +1,74 @@
+//
+//  Core6502Decimal.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include "Core6502Decimal.hpp"
+#include "Core6502ALU.hpp"
+
+uint16_t Core6502::Decimal::adc[2 * 0x10000];
+uint8_t Core6502::Decimal::sbc[2 * 0x10000];
+
+// NMOS decimal ADC.  See "Decimal Mode" by Bruce Clark, appendix A, on 6502.org.
+static uint16_t decimalADC(uint8_t carry, uint8_t a, uint8_t b) {
+
+    // Low digit, carrying into the high one
+    int low = (a & 0x0F) + (b & 0x0F) + carry;
+    if (low >= 0x0A) low = ((low + 0x06) & 0x0F) + 0x10;
+
+    // N and V from the sum so far, as signed bytes
+    int partial = (int8_t)(a & 0xF0) + (int8_t)(b & 0xF0) + low;
+    bool negative = partial & 0x80;
+    bool overflow = partial < -128 || partial > 127;
+
+    // Then the high digit
+    int sum = (a & 0xF0) + (b & 0xF0) + low;
+    if (sum >= 0xA0) sum += 0x60;
+
+    bool zero = (uint8_t)(a + b + carry) == 0;
+
+    uint8_t flags = (sum >= 0x100 ? Core6502::ALU::FlagC : 0) | (zero ? Core6502::ALU::FlagZ : 0) |
+                    (overflow ? Core6502::ALU::FlagV : 0) | (negative ? Core6502::ALU::FlagN : 0);
+
+    return (uint8_t)sum | flags << 8;
+
+}
+
+// NMOS decimal SBC result, with borrow subtracted as the SBC template does
+static uint8_t decimalSBC(uint8_t borrow, uint8_t a, uint8_t b) {
+
+    int low = (a & 0x0F) - (b & 0x0F) - borrow;
+    if (low < 0) low = ((low - 0x06) & 0x0F) - 0x10;
+
+    int difference = (a & 0xF0) - (b & 0xF0) + low;
+    if (difference < 0) difference -= 0x60;
+
+    return (uint8_t)difference;
+
+}
+
+static bool build() {
+
+    for (int carry = 0; carry < 2; carry++) {
+        for (int a = 0; a < 0x100; a++) {
+            for (int b = 0; b < 0x100; b++) {
+                uint32_t i = Core6502::Decimal::index(carry, a, b);
+                Core6502::Decimal::adc[i] = decimalADC(carry, a, b);
+                Core6502::Decimal::sbc[i] = decimalSBC(carry, a, b);
+            }
+        }
+    }
+
+    return true;
+
+}
+
+void Core6502::Decimal::initialize() {
+
+    // Built once, by whichever thread gets here first
+    static const bool built = build();
+    (void)built;
+
+}
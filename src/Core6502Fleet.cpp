@@ -0,0 +1,149 @@
+//
+//  Core6502Fleet.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include "Core6502.hpp"
+#include "Core6502Fleet.hpp"
+
+// Queue of instance indices.  The owner runs from the front and requeues at the back,
+// thieves take from the back.  Padded so workers' hot fields don't share cache lines.
+struct Core6502::Fleet::Worker {
+    char front[64];
+    std::mutex lock;
+    std::deque<size_t> queue;
+
+    uint64_t cycles;
+    uint64_t steals;
+
+    std::atomic<size_t> * remaining;    // Unfinished instances, shared by every worker
+    char back[64];
+
+    bool pop(size_t & index) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (queue.empty()) return false;
+        index = queue.front();
+        queue.pop_front();
+        return true;
+    }
+
+    bool steal(size_t & index) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (queue.empty()) return false;
+        index = queue.back();
+        queue.pop_back();
+        return true;
+    }
+
+    void push(size_t index) {
+        std::lock_guard<std::mutex> guard(lock);
+        queue.push_back(index);
+    }
+};
+
+Core6502::Fleet::Fleet() {
+
+    quantum = 10000;
+    steals = 0;
+
+}
+
+size_t Core6502::Fleet::add(Core6502::CPU & cpu, uint64_t cycles, Core6502::FleetDoneCallback done,
+                            void * context, int32_t stopPC) {
+
+    Instance instance = {&cpu, cycles, stopPC, done, context};
+    instances.push_back(instance);
+
+    return instances.size() - 1;
+
+}
+
+size_t Core6502::Fleet::size() const {
+    return instances.size();
+}
+
+void Core6502::Fleet::run(unsigned threads) {
+
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+    if (quantum == 0) quantum = 1;
+
+    std::atomic<size_t> remaining(instances.size());
+    std::vector<Worker *> workers;
+
+    // Deal instances out round robin
+    for (unsigned i = 0; i < threads; i++) {
+        Worker * worker = new Worker();
+        worker->cycles = 0;
+        worker->steals = 0;
+        worker->remaining = &remaining;
+        workers.push_back(worker);
+    }
+
+    for (size_t i = 0; i < instances.size(); i++) workers[i % threads]->queue.push_back(i);
+
+    // This thread is worker 0
+    std::vector<std::thread> pool;
+    for (unsigned i = 1; i < threads; i++) pool.push_back(std::thread(&Core6502::Fleet::work, this, std::ref(workers), i));
+    work(workers, 0);
+    for (size_t i = 0; i < pool.size(); i++) pool[i].join();
+
+    steals = 0;
+    workerCycles.clear();
+
+    for (unsigned i = 0; i < threads; i++) {
+        steals += workers[i]->steals;
+        workerCycles.push_back(workers[i]->cycles);
+        delete workers[i];
+    }
+
+}
+
+void Core6502::Fleet::work(std::vector<Core6502::Fleet::Worker *> & workers, size_t self) {
+
+    Worker & worker = *workers[self];
+
+    while (worker.remaining->load(std::memory_order_acquire) > 0) {
+
+        size_t index;
+
+        // Own queue first, then the other workers' in turn
+        bool found = worker.pop(index);
+        for (size_t i = 1; !found && i < workers.size(); i++) {
+            found = workers[(self + i) % workers.size()]->steal(index);
+            if (found) worker.steals++;
+        }
+
+        if (!found) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        Instance & instance = instances[index];
+        Core6502::CPU & cpu = *instance.cpu;
+
+        uint32_t slice = instance.cycles < quantum ? (uint32_t)instance.cycles : quantum;
+        uint32_t ran = slice;
+
+        if (instance.stopPC >= 0) ran = cpu.runUntil((uint16_t)instance.stopPC, slice);
+        else cpu.run(slice);
+
+        worker.cycles += ran;
+        instance.cycles -= ran;
+
+        if (instance.cycles == 0 || (instance.stopPC >= 0 && cpu.registers.PC == instance.stopPC)) {
+            if (instance.done) instance.done(instance.context, cpu);
+            worker.remaining->fetch_sub(1, std::memory_order_release);
+        } else {
+            worker.push(index);
+        }
+
+    }
+
+}
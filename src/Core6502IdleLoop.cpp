@@ -0,0 +1,134 @@
+//
+//  Core6502IdleLoop.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include <string.h>
+#include "Core6502.hpp"
+
+// Instructions in the longest loop looked for
+#define CORE6502_MAX_IDLE_LENGTH 8
+
+static const uint8_t instructionLength[0x100] = {
+#define CORE6502_OPCODE(opCode, cycles, operation, addressing) CORE6502_ADDRESSING_LENGTH_##addressing,
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+};
+
+// Default table entries, to tell when an opcode has been overridden
+static const Core6502::Instruction defaultInstructions[0x100] = {
+#define CORE6502_OPCODE(opCode, cycles, operation, addressing) \
+    {opCode, cycles, Core6502::operation, CORE6502_ADDRESSING_##addressing},
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+};
+
+bool Core6502::CPU::sideEffectFree(uint8_t opCode) {
+
+    switch (opCode) {
+        case 0x81: case 0x85: case 0x8D: case 0x91: case 0x95: case 0x99: case 0x9D:   // STA
+        case 0x86: case 0x8E: case 0x96:                                                // STX
+        case 0x84: case 0x8C: case 0x94:                                                // STY
+        case 0x06: case 0x0E: case 0x16: case 0x1E:                                     // ASL
+        case 0x46: case 0x4E: case 0x56: case 0x5E:                                     // LSR
+        case 0x26: case 0x2E: case 0x36: case 0x3E:                                     // ROL
+        case 0x66: case 0x6E: case 0x76: case 0x7E:                                     // ROR
+        case 0xE6: case 0xEE: case 0xF6: case 0xFE:                                     // INC
+        case 0xC6: case 0xCE: case 0xD6: case 0xDE:                                     // DEC
+        case 0x48: case 0x08: case 0x68: case 0x28:                                     // Stack
+        case 0x9A: case 0xBA:                                                           // TXS/TSX, which go through $0100+SP here
+        case 0x00: case 0x20: case 0x40: case 0x60:                                     // BRK/JSR/RTI/RTS
+        case 0x6C:                                                                      // JMP ()
+            return false;
+        default:
+            return true;
+    }
+
+}
+
+// Addresses of the instructions in a loop through start that only runs side effect free,
+// unmodified opcodes, or 0 when there isn't one.  The loop follows JMPs and backward
+// branches and falls through forward branches, which are taken as ways out.
+static int findLoop(Core6502::CPU & cpu, uint16_t start, uint16_t * path) {
+
+    uint16_t addr = start;
+
+    for (int count = 0; count < CORE6502_MAX_IDLE_LENGTH; count++) {
+
+        // Code on I/O pages could change between passes
+        const uint8_t * page = cpu.bus.readPage[addr >> 8];
+        if (!page) return 0;
+
+        uint8_t opCode = page[addr & 0xFF];
+        uint8_t length = instructionLength[opCode];
+        for (int i = 1; i < length; i++)
+            if (!cpu.bus.readPage[(uint16_t)(addr + i) >> 8]) return 0;
+
+        const Core6502::Instruction & inst = cpu.instructions[opCode];
+        const Core6502::Instruction & standard = defaultInstructions[opCode];
+        if (!Core6502::CPU::sideEffectFree(opCode) || inst.instructionFunction != standard.instructionFunction ||
+            inst.cycles != standard.cycles || inst.addressFunction != standard.addressFunction)
+            return 0;
+
+        uint16_t operand = 0;
+        if (length > 1) operand  = cpu.bus.read(addr + 1);
+        if (length > 2) operand |= cpu.bus.read(addr + 2) << 8;
+
+        path[count] = addr;
+
+        uint16_t next = addr + length;
+        if (opCode == 0x4C) {
+            next = operand;
+        } else if ((opCode & 0x1F) == 0x10) {
+            uint16_t target = next + (int8_t)operand;
+            if (target <= addr) next = target;
+        }
+
+        if (next == start) return count + 1;
+        addr = next;
+
+    }
+
+    return 0;
+
+}
+
+uint32_t Core6502::CPU::skipIdle(uint32_t cycles, int32_t stopPC) {
+
+    uint16_t path[CORE6502_MAX_IDLE_LENGTH];
+    int count = findLoop(*this, registers.PC, path);
+    if (!count) return 0;
+
+    // Running would stop partway round
+    for (int i = 0; i < count; i++)
+        if (path[i] == stopPC) return 0;
+
+    // One pass on the table core, which every core agrees with for unmodified opcodes.  It's
+    // part of the run either way, so stop once it leaves the loop or the budget runs out.
+    decltype(registers) before = registers;
+    uint8_t statusBefore = status.raw;
+    uint32_t reads = bus.slowReads;
+    uint32_t elapsed = 0;
+
+    for (int i = 0; i < count; i++) {
+        Core6502::Instruction & inst = instructions[fetchByte()];
+        inst.instructionFunction(*this, inst);
+        elapsed += inst.cycles + extraCycles;
+        extraCycles = 0;
+
+        if (elapsed >= cycles || registers.PC != path[(i + 1) % count]) return elapsed;
+    }
+
+    if (bus.slowReads != reads || status.raw != statusBefore ||
+        memcmp(&before, &registers, sizeof(registers)) != 0) return elapsed;
+
+    // Every pass from here on is the same as the last.  Skip the ones that fit, the caller
+    // runs the partial pass the budget ends in.
+    uint32_t skipped = (cycles - elapsed) / elapsed * elapsed;
+    idleCyclesSkipped += skipped;
+
+    return elapsed + skipped;
+
+}
@@ -0,0 +1,102 @@
+//
+//  Core6502Interpreter.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include "Core6502.hpp"
+#include "Core6502Operations.hpp"
+#include "Core6502OperationTemplates.hpp"
+#include "Core6502Flags.hpp"
+#include "Core6502Trace.hpp"
+#include "Core6502Profiler.hpp"
+
+// Computed goto is a GCC/Clang extension, everything else gets the switch
+#if defined(__GNUC__) && !defined(CORE6502_NO_COMPUTED_GOTO)
+#define CORE6502_COMPUTED_GOTO 1
+#else
+#define CORE6502_COMPUTED_GOTO 0
+#endif
+
+// Page crossing and taken branch cycles, only looked at for the modes that can add them
+#define CORE6502_EXTRA_CYCLES(addressing) \
+    if (CORE6502_ADDRESSING_VARIABLE_##addressing) { \
+        elapsed += extraCycles; \
+        extraCycles = 0; \
+    }
+
+uint32_t Core6502::CPU::interpret(uint32_t cycles, int32_t stopPC, bool (*predicate)(Core6502::CPU&)) {
+
+    uint32_t elapsed = 0;
+
+    CORE6502_FLAGS::load(*this);
+    CORE6502_TRACE_ATTACHED(tracer, *this)
+    CORE6502_PROFILE_ATTACHED(profile, *this)
+
+#if CORE6502_COMPUTED_GOTO
+
+    // One label per opcode
+    static const void * const dispatch[0x100] = {
+#define CORE6502_OPCODE(opCode, opCycles, operation, addressing) &&op_##opCode,
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+    };
+
+    // Checks stop conditions and jumps straight to the next opcode's case.  Predicates are
+    // called from one shared place so each case stays small.
+#define CORE6502_NEXT() \
+    if (elapsed >= cycles || registers.PC == stopPC) goto done; \
+    if (predicate) goto check; \
+    CORE6502_TRACE_INSTRUCTION(tracer, *this, CORE6502_FLAGS::raw(*this), elapsed) \
+    CORE6502_PROFILE_INSTRUCTION(profile, *this, elapsed) \
+    goto *dispatch[fetchByte()];
+
+    CORE6502_NEXT()
+
+check:
+    if (Core6502::Flags::observe<CORE6502_FLAGS>(*this, predicate)) goto done;
+    CORE6502_TRACE_INSTRUCTION(tracer, *this, CORE6502_FLAGS::raw(*this), elapsed)
+    CORE6502_PROFILE_INSTRUCTION(profile, *this, elapsed)
+    goto *dispatch[fetchByte()];
+
+#define CORE6502_OPCODE(opCode, opCycles, operation, addressing) \
+    op_##opCode: \
+        Core6502::operation<CORE6502_ADDRESSING_MODE_##addressing, CORE6502_FLAGS>(*this); \
+        elapsed += opCycles; \
+        CORE6502_EXTRA_CYCLES(addressing) \
+        CORE6502_NEXT()
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+#undef CORE6502_NEXT
+
+done:
+    CORE6502_FLAGS::store(*this);
+    return elapsed;
+
+#else
+
+    while (elapsed < cycles && registers.PC != stopPC &&
+           !(predicate && Core6502::Flags::observe<CORE6502_FLAGS>(*this, predicate))) {
+
+        CORE6502_TRACE_INSTRUCTION(tracer, *this, CORE6502_FLAGS::raw(*this), elapsed)
+        CORE6502_PROFILE_INSTRUCTION(profile, *this, elapsed)
+        switch (fetchByte()) {
+#define CORE6502_OPCODE(opCode, opCycles, operation, addressing) \
+            case opCode: \
+                Core6502::operation<CORE6502_ADDRESSING_MODE_##addressing, CORE6502_FLAGS>(*this); \
+                elapsed += opCycles; \
+                CORE6502_EXTRA_CYCLES(addressing) \
+                break;
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+        }
+
+    }
+
+    CORE6502_FLAGS::store(*this);
+    return elapsed;
+
+#endif
+
+}
@@ -0,0 +1,1038 @@
+//
+//  Core6502JIT.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include "Core6502.hpp"
+#include "Core6502JIT.hpp"
+#include "Core6502OperationTemplates.hpp"
+#include <string.h>
+#include <sys/mman.h>
+
+#if !defined(__x86_64__) || defined(_WIN32)
+#error "Core6502JIT emits x86-64 System V code"
+#endif
+
+// Pages invalidated more often than this are left to the interpreter until the next flush
+#define CORE6502_MAX_PAGE_REWRITES 64
+
+// Largest budget handed to a trace, keeps the signed cycle counter far from overflow
+#define CORE6502_MAX_TRACE_BUDGET 0x40000000
+
+namespace {
+
+    // Operations emitted inline.  Everything else calls the operation templates.
+    enum Kind {
+        Kind_LDA, Kind_LDX, Kind_LDY,
+        Kind_STA, Kind_STX, Kind_STY,
+        Kind_AND, Kind_ORA, Kind_EOR,
+        Kind_CMP, Kind_CPX, Kind_CPY,
+        Kind_INX, Kind_INY, Kind_DEX, Kind_DEY,
+        Kind_ADC,
+        Kind_TAX, Kind_TAY, Kind_TXA, Kind_TYA,
+        Kind_JMP,
+        Kind_BCC, Kind_BCS, Kind_BEQ, Kind_BMI, Kind_BNE, Kind_BPL, Kind_BVC, Kind_BVS,
+        Kind_CLC, Kind_CLD, Kind_CLI, Kind_CLV, Kind_SEC, Kind_SED, Kind_SEI,
+        Kind_NOP,
+
+        // Called through decodedOperations
+        Kind_Helper,
+        Kind_BIT = Kind_Helper, Kind_ROL = Kind_Helper, Kind_ROR = Kind_Helper,
+        Kind_ASL = Kind_Helper, Kind_LSR = Kind_Helper, Kind_INC = Kind_Helper,
+        Kind_DEC = Kind_Helper, Kind_SBC = Kind_Helper, Kind_TSX = Kind_Helper,
+        Kind_TXS = Kind_Helper, Kind_PHA = Kind_Helper, Kind_PHP = Kind_Helper,
+        Kind_PLA = Kind_Helper, Kind_PLP = Kind_Helper,
+
+        // Called through decodedOperations and leave PC somewhere only known at run time
+        Kind_Exit,
+        Kind_JSR = Kind_Exit, Kind_RTS = Kind_Exit, Kind_RTI = Kind_Exit, Kind_BRK = Kind_Exit
+    };
+
+    enum Mode {
+        Mode_IMP, Mode_IMM, Mode_ACC, Mode_ZPG, Mode_ZPX, Mode_ZPY, Mode_ABS,
+        Mode_ABX, Mode_ABY, Mode_IZX, Mode_IZY, Mode_IND, Mode_REL
+    };
+
+    const uint8_t kinds[0x100] = {
+#define CORE6502_OPCODE(opCode, cycles, operation, addressing) Kind_##operation,
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+    };
+
+    const uint8_t modes[0x100] = {
+#define CORE6502_OPCODE(opCode, cycles, operation, addressing) Mode_##addressing,
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+    };
+
+    const uint8_t lengths[0x100] = {
+#define CORE6502_OPCODE(opCode, cycles, operation, addressing) CORE6502_ADDRESSING_LENGTH_##addressing,
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+    };
+
+    const uint8_t cycleCounts[0x100] = {
+#define CORE6502_OPCODE(opCode, cycles, operation, addressing) cycles,
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+    };
+
+    // Host registers
+    enum Reg {
+        RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI,
+        R8, R9, R10, R11, R12, R13, R14, R15
+    };
+
+    // Register assignment inside a trace.  All callee saved, so calls out keep them.
+    const int CPUREG = RBX;     // Core6502::CPU *
+    const int AREG = R12;       // Zero extended 6502 registers
+    const int XREG = R13;
+    const int YREG = R14;
+    const int PREG = R15;       // Status, N/Z stale while lazy
+    const int NZREG = RBP;      // Last result N/Z come from while lazy
+
+    // Stack slots
+    const int32_t BUDGET = 0;   // Cycles left, exits once <= 0
+    const int32_t STOPPC = 4;   // runUntil() target or -1
+
+    enum Cond {
+        CondO = 0x0, CondB = 0x2, CondAE = 0x3, CondE = 0x4, CondNE = 0x5, CondLE = 0xE
+    };
+
+    // Status bits in CPU::status.raw
+    const uint32_t FlagC = 0x01, FlagZ = 0x02, FlagI = 0x04, FlagD = 0x08, FlagV = 0x20, FlagN = 0x40;
+
+    // Byte offsets of CPU fields from the CPU pointer
+    struct Layout {
+        int32_t PC, A, X, Y, P, extraCycles, readPage, writePage;
+    };
+
+    uint8_t jitRead(Core6502::CPU * cpu, uint32_t addr) {
+        return cpu->read(addr);
+    }
+
+    void jitWrite(Core6502::CPU * cpu, uint32_t addr, uint32_t value) {
+        cpu->write(addr, value);
+    }
+
+    // Minimal x86-64 encoder.  Writes past capacity are dropped and flag the buffer full.
+    class Emitter {
+    public:
+        uint8_t * start;
+        size_t size;
+        size_t capacity;
+        bool full;
+
+        Emitter(uint8_t * start, size_t capacity) : start(start), size(0), capacity(capacity), full(false) {}
+
+        void byte(uint8_t value) {
+            if (size < capacity) start[size] = value;
+            else full = true;
+            size++;
+        }
+        void word(uint16_t value) { byte(value); byte(value >> 8); }
+        void dword(uint32_t value) { word(value); word(value >> 16); }
+        void qword(uint64_t value) { dword(value); dword(value >> 32); }
+
+        // REX prefix.  Byte operations always get one so SIL/DIL/BPL are addressable.
+        void rex(bool w, int reg, int index, int base, bool bytes) {
+            uint8_t prefix = 0x40 | (w << 3) | ((reg >> 3) << 2) | ((index >> 3) << 1) | (base >> 3);
+            if (prefix != 0x40 || bytes) byte(prefix);
+        }
+
+        void opcode(uint32_t op) {
+            if (op > 0xFF) byte(op >> 8);
+            byte(op);
+        }
+
+        // op reg, rm
+        void rr(uint32_t op, int reg, int rm, bool w = false, bool bytes = false) {
+            rex(w, reg, 0, rm, bytes);
+            opcode(op);
+            byte(0xC0 | (reg & 7) << 3 | (rm & 7));
+        }
+
+        // op reg, [base + disp]
+        void rm(uint32_t op, int reg, int base, int32_t disp, bool w = false, bool bytes = false) {
+            rex(w, reg, 0, base, bytes);
+            opcode(op);
+            byte(0x80 | (reg & 7) << 3 | (base & 7));
+            if ((base & 7) == RSP) byte(0x24);
+            dword(disp);
+        }
+
+        // op reg, [base + index * (1 << scale) + disp]
+        void rsib(uint32_t op, int reg, int base, int index, int scale, int32_t disp, bool w = false, bool bytes = false) {
+            rex(w, reg, index, base, bytes);
+            opcode(op);
+            byte(0x84 | (reg & 7) << 3);
+            byte(scale << 6 | (index & 7) << 3 | (base & 7));
+            dword(disp);
+        }
+
+        // Group 1 ALU (add 0, or 1, and 4, sub 5, cmp 7) with a 32-bit immediate
+        void aluImm(int ext, int reg, uint32_t imm) {
+            rex(false, 0, 0, reg, false);
+            byte(0x81);
+            byte(0xC0 | ext << 3 | (reg & 7));
+            dword(imm);
+        }
+        void aluMemImm(int ext, int base, int32_t disp, uint32_t imm) {
+            rex(false, 0, 0, base, false);
+            byte(0x81);
+            byte(0x80 | ext << 3 | (base & 7));
+            if ((base & 7) == RSP) byte(0x24);
+            dword(disp);
+            dword(imm);
+        }
+
+        void movImm32(int reg, uint32_t imm) {
+            rex(false, 0, 0, reg, false);
+            byte(0xB8 | (reg & 7));
+            dword(imm);
+        }
+        void movImm64(int reg, uint64_t imm) {
+            rex(true, 0, 0, reg, false);
+            byte(0xB8 | (reg & 7));
+            qword(imm);
+        }
+
+        // Shift by immediate (shl 4, shr 5)
+        void shiftImm(int ext, int reg, uint8_t count) {
+            rex(false, 0, 0, reg, false);
+            byte(0xC1);
+            byte(0xC0 | ext << 3 | (reg & 7));
+            byte(count);
+        }
+
+        void testImm(int reg, uint32_t imm) {
+            rex(false, 0, 0, reg, false);
+            byte(0xF7);
+            byte(0xC0 | (reg & 7));
+            dword(imm);
+        }
+
+        void setcc(int cond, int reg) {
+            rex(false, 0, 0, reg, true);
+            byte(0x0F);
+            byte(0x90 | cond);
+            byte(0xC0 | (reg & 7));
+        }
+
+        // inc (0) / dec (1) on a byte register
+        void incdec8(int ext, int reg) {
+            rex(false, 0, 0, reg, true);
+            byte(0xFE);
+            byte(0xC0 | ext << 3 | (reg & 7));
+        }
+
+        // bt reg32, bit
+        void bt(int reg, uint8_t bit) {
+            rex(false, 0, 0, reg, false);
+            byte(0x0F);
+            byte(0xBA);
+            byte(0xE0 | (reg & 7));
+            byte(bit);
+        }
+
+        void push(int reg) {
+            if (reg & 8) byte(0x41);
+            byte(0x50 | (reg & 7));
+        }
+        void pop(int reg) {
+            if (reg & 8) byte(0x41);
+            byte(0x58 | (reg & 7));
+        }
+
+        void call(const void * function) {
+            movImm64(RAX, (uint64_t)function);
+            byte(0xFF);
+            byte(0xD0);
+        }
+
+        // Forward jumps return the end of the rel32 for patch()
+        size_t jcc(int cond) {
+            byte(0x0F);
+            byte(0x80 | cond);
+            dword(0);
+            return size;
+        }
+        size_t jmp() {
+            byte(0xE9);
+            dword(0);
+            return size;
+        }
+        void jmpTo(size_t target) {
+            byte(0xE9);
+            dword((uint32_t)(target - (size + 4)));
+        }
+        void patch(size_t fixup, size_t target) {
+            int32_t rel = (int32_t)(target - fixup);
+            if (fixup <= capacity) memcpy(start + fixup - 4, &rel, 4);
+        }
+    };
+
+    // Translates one trace.  Trace signature: int32_t (CPU *, int32_t budget, int32_t stopPC),
+    // returns the budget left.
+    class TraceCompiler {
+    public:
+        TraceCompiler(Emitter & e, const Layout & layout, Core6502::Bus & bus, bool * invalidated)
+            : pageCount(0), e(e), layout(layout), bus(bus), invalidated(invalidated), lazy(false) {}
+
+        // Returns instructions translated, 0 when nothing at pc could be
+        int compile(uint16_t pc, bool (*cacheable)(void *, uint8_t), void * context);
+
+        uint8_t pages[Core6502::JIT::MaxTracePages];
+        int pageCount;
+
+    private:
+        struct Exit {
+            size_t fixup;
+            uint16_t pc;
+            bool lazy;
+            uint8_t cycles;         // Cycles not yet taken from the budget
+        };
+        struct Taken {
+            size_t fixup;
+            uint16_t target;
+            bool lazy;
+            uint8_t cycles;
+        };
+        struct Label {
+            uint16_t pc;
+            size_t offset;
+            bool lazy;
+        };
+
+        Emitter & e;
+        const Layout & layout;
+        Core6502::Bus & bus;
+        bool * invalidated;
+
+        bool lazy;                  // N/Z live in NZREG instead of PREG
+        std::vector<Exit> exits;
+        std::vector<Taken> takens;
+        std::vector<Label> labels;
+        std::vector<size_t> dynamicExits;
+
+        bool addPages(uint16_t pc, uint8_t length, bool (*cacheable)(void *, uint8_t), void * context);
+        const Label * label(uint16_t pc) const;
+
+        void prologue();
+        void epilogue();
+        void materialize();
+        void settle();
+        void sync(uint16_t pc);
+        void reload();
+        void exitIf(int cond, uint16_t pc, uint8_t cycles);
+        void exitTo(uint16_t pc, uint8_t cycles);
+        void checks(uint16_t pc, uint8_t cycles);
+        bool jumpTo(uint16_t pc);
+        void checkInvalidated(uint16_t pc, uint8_t cycles);
+
+        void address(uint8_t mode, uint16_t operand);
+        void read(uint16_t pc);
+        void write(uint16_t pc, uint8_t cycles);
+        void operand(uint8_t mode, uint16_t operand, uint16_t pc);
+        void result(int reg);
+    };
+
+    const TraceCompiler::Label * TraceCompiler::label(uint16_t pc) const {
+
+        for (size_t i = 0; i < labels.size(); i++)
+            if (labels[i].pc == pc) return &labels[i];
+
+        return NULL;
+
+    }
+
+    bool TraceCompiler::addPages(uint16_t pc, uint8_t length, bool (*cacheable)(void *, uint8_t), void * context) {
+
+        uint8_t needed[2] = { (uint8_t)(pc >> 8), (uint8_t)((uint16_t)(pc + length - 1) >> 8) };
+
+        for (int i = 0; i < 2; i++) {
+            bool known = false;
+            for (int p = 0; p < pageCount; p++) known |= pages[p] == needed[i];
+            if (known) continue;
+
+            if (pageCount == Core6502::JIT::MaxTracePages || !cacheable(context, needed[i])) return false;
+            pages[pageCount++] = needed[i];
+        }
+
+        return true;
+
+    }
+
+    void TraceCompiler::prologue() {
+
+        e.push(RBX); e.push(RBP);
+        e.push(R12); e.push(R13); e.push(R14); e.push(R15);
+
+        // sub rsp, 8 keeps calls 16 byte aligned and holds budget/stopPC
+        e.byte(0x48); e.byte(0x83); e.byte(0xEC); e.byte(0x08);
+
+        e.rr(0x89, RDI, CPUREG, true);              // mov rbx, rdi
+        e.rm(0x89, RSI, RSP, BUDGET);               // mov [rsp], esi
+        e.rm(0x89, RDX, RSP, STOPPC);               // mov [rsp + 4], edx
+
+        reload();
+
+    }
+
+    void TraceCompiler::epilogue() {
+
+        e.rm(0x88, AREG, CPUREG, layout.A, false, true);
+        e.rm(0x88, XREG, CPUREG, layout.X, false, true);
+        e.rm(0x88, YREG, CPUREG, layout.Y, false, true);
+        e.rm(0x88, PREG, CPUREG, layout.P, false, true);
+
+        e.rm(0x8B, RAX, RSP, BUDGET);               // mov eax, [rsp]
+        e.byte(0x48); e.byte(0x83); e.byte(0xC4); e.byte(0x08);
+
+        e.pop(R15); e.pop(R14); e.pop(R13); e.pop(R12);
+        e.pop(RBP); e.pop(RBX);
+        e.byte(0xC3);
+
+    }
+
+    // eax = status with the lazy N/Z folded in.  Clobbers edx.
+    void TraceCompiler::materialize() {
+
+        e.rr(0x89, PREG, RAX);                      // mov eax, r15d
+        e.aluImm(4, RAX, 0xFF & ~(FlagN | FlagZ));
+        e.rr(0x85, NZREG, NZREG);                   // test ebp, ebp
+        e.setcc(CondE, RDX);
+        e.rr(0x0FB6, RDX, RDX, false, true);        // movzx edx, dl
+        e.rr(0x01, RDX, RDX);                       // add edx, edx -> Z
+        e.rr(0x09, RDX, RAX);                       // or eax, edx
+        e.rr(0x89, NZREG, RDX);                     // mov edx, ebp
+        e.aluImm(4, RDX, 0x80);
+        e.shiftImm(5, RDX, 1);                      // N
+        e.rr(0x09, RDX, RAX);
+
+    }
+
+    void TraceCompiler::settle() {
+
+        if (!lazy) return;
+
+        materialize();
+        e.rr(0x89, RAX, PREG);                      // mov r15d, eax
+        lazy = false;
+
+    }
+
+    // Stores registers and PC for a call out.  Leaves the host registers as they are.
+    void TraceCompiler::sync(uint16_t pc) {
+
+        e.rm(0x88, AREG, CPUREG, layout.A, false, true);
+        e.rm(0x88, XREG, CPUREG, layout.X, false, true);
+        e.rm(0x88, YREG, CPUREG, layout.Y, false, true);
+
+        if (lazy) {
+            materialize();
+            e.rm(0x88, RAX, CPUREG, layout.P, false, true);
+        } else {
+            e.rm(0x88, PREG, CPUREG, layout.P, false, true);
+        }
+
+        // mov word [rbx + PC], pc
+        e.byte(0x66);
+        e.rm(0xC7, 0, CPUREG, layout.PC);
+        e.word(pc);
+
+    }
+
+    void TraceCompiler::reload() {
+
+        e.rm(0x0FB6, AREG, CPUREG, layout.A);
+        e.rm(0x0FB6, XREG, CPUREG, layout.X);
+        e.rm(0x0FB6, YREG, CPUREG, layout.Y);
+        e.rm(0x0FB6, PREG, CPUREG, layout.P);
+        lazy = false;
+
+    }
+
+    void TraceCompiler::exitIf(int cond, uint16_t pc, uint8_t cycles) {
+        exits.push_back((Exit){e.jcc(cond), pc, lazy, cycles});
+    }
+
+    void TraceCompiler::exitTo(uint16_t pc, uint8_t cycles) {
+        exits.push_back((Exit){e.jmp(), pc, lazy, cycles});
+    }
+
+    // Charges an instruction and leaves at pc if the budget ran out or pc is the stop target
+    void TraceCompiler::checks(uint16_t pc, uint8_t cycles) {
+
+        e.aluMemImm(5, RSP, BUDGET, cycles);
+        exitIf(CondLE, pc, 0);
+        e.aluMemImm(7, RSP, STOPPC, pc);
+        exitIf(CondE, pc, 0);
+
+    }
+
+    // Jumps to pc if it's already translated in this trace and its N/Z state can be matched
+    bool TraceCompiler::jumpTo(uint16_t pc) {
+
+        const Label * target = label(pc);
+        if (!target || (target->lazy && !lazy)) return false;
+
+        if (!target->lazy) settle();
+        e.jmpTo(target->offset);
+
+        return true;
+
+    }
+
+    void TraceCompiler::checkInvalidated(uint16_t pc, uint8_t cycles) {
+
+        // cmp byte [invalidated], 0
+        e.movImm64(RAX, (uint64_t)invalidated);
+        e.byte(0x80); e.byte(0x38); e.byte(0x00);
+        exitIf(CondNE, pc, cycles);
+
+    }
+
+    // ecx = effective address
+    void TraceCompiler::address(uint8_t mode, uint16_t operand) {
+
+        switch (mode) {
+            case Mode_ZPX:
+            case Mode_ZPY:
+                e.rr(0x0FB6, RCX, mode == Mode_ZPX ? XREG : YREG, false, true);
+                e.aluImm(0, RCX, operand);
+                e.rr(0x0FB6, RCX, RCX, false, true);                    // movzx ecx, cl
+                break;
+            case Mode_ABX:
+            case Mode_ABY:
+                e.rr(0x0FB6, RCX, mode == Mode_ABX ? XREG : YREG, false, true);
+                e.aluImm(0, RCX, operand);
+                e.rr(0x0FB7, RCX, RCX);                                 // movzx ecx, cx
+                break;
+            default:
+                e.movImm32(RCX, operand);
+                break;
+        }
+
+    }
+
+    // eax = byte at ecx through the bus page table
+    void TraceCompiler::read(uint16_t pc) {
+
+        e.rr(0x89, RCX, RDX);                                           // mov edx, ecx
+        e.shiftImm(5, RDX, 8);
+        e.rsib(0x8B, RAX, CPUREG, RDX, 3, layout.readPage, true);       // mov rax, [rbx + rdx*8 + readPage]
+        e.rr(0x85, RAX, RAX, true);
+        size_t slow = e.jcc(CondE);
+
+        e.rr(0x0FB6, RDX, RCX, false, true);                            // movzx edx, cl
+        e.rsib(0x0FB6, RAX, RAX, RDX, 0, 0);                            // movzx eax, byte [rax + rdx]
+        size_t done = e.jmp();
+
+        // Unmapped or I/O page
+        e.patch(slow, e.size);
+        sync(pc);
+        e.rr(0x89, CPUREG, RDI, true);
+        e.rr(0x89, RCX, RSI);
+        e.call((const void *)jitRead);
+
+        e.patch(done, e.size);
+
+    }
+
+    // Writes esi to ecx through the bus page table
+    void TraceCompiler::write(uint16_t pc, uint8_t cycles) {
+
+        e.rr(0x89, RCX, RDX);
+        e.shiftImm(5, RDX, 8);
+        e.rsib(0x8B, RAX, CPUREG, RDX, 3, layout.writePage, true);
+        e.rr(0x85, RAX, RAX, true);
+        size_t slow = e.jcc(CondE);
+
+        e.rr(0x0FB6, RDX, RCX, false, true);
+        e.rsib(0x88, RSI, RAX, RDX, 0, 0, false, true);                 // mov [rax + rdx], sil
+        size_t done = e.jmp();
+
+        // ROM, I/O or a trapped page, which may be this trace's own code
+        e.patch(slow, e.size);
+        sync(pc);
+        e.rr(0x89, RSI, RDX);
+        e.rr(0x89, RCX, RSI);
+        e.rr(0x89, CPUREG, RDI, true);
+        e.call((const void *)jitWrite);
+        checkInvalidated(pc, cycles);
+
+        e.patch(done, e.size);
+
+    }
+
+    // eax = operand value
+    void TraceCompiler::operand(uint8_t mode, uint16_t operand, uint16_t pc) {
+
+        if (mode == Mode_IMM) {
+            e.movImm32(RAX, operand & 0xFF);
+            return;
+        }
+
+        address(mode, operand);
+        read(pc);
+
+        // A cycle more when indexing crossed a page
+        if (mode == Mode_ABX || mode == Mode_ABY) {
+            e.rr(0x0FB6, RDX, mode == Mode_ABX ? XREG : YREG, false, true);
+            e.aluImm(0, RDX, operand & 0xFF);
+            e.shiftImm(5, RDX, 8);
+            e.rm(0x29, RDX, RSP, BUDGET);                               // sub [rsp + BUDGET], edx
+        }
+
+    }
+
+    // N/Z now come from reg
+    void TraceCompiler::result(int reg) {
+        e.rr(0x89, reg, NZREG);
+        lazy = true;
+    }
+
+    int TraceCompiler::compile(uint16_t start, bool (*cacheable)(void *, uint8_t), void * context) {
+
+        prologue();
+
+        uint16_t pc = start;
+        int count = 0;
+        bool linked = false;
+
+        while (count < Core6502::JIT::MaxTraceLength) {
+
+            // Loops back into the trace
+            if (label(pc) && jumpTo(pc)) {
+                linked = true;
+                break;
+            }
+
+            uint8_t opCode = bus.read(pc);
+            uint8_t length = lengths[opCode];
+            uint8_t mode = modes[opCode];
+            uint8_t kind = kinds[opCode];
+            uint8_t cycles = cycleCounts[opCode];
+
+            if (!addPages(pc, length, cacheable, context)) break;
+
+            uint16_t value = 0;
+            if (length > 1) value  = bus.read(pc + 1);
+            if (length > 2) value |= bus.read(pc + 2) << 8;
+
+            uint16_t next = pc + length;
+
+            if (!label(pc)) labels.push_back((Label){pc, e.size, lazy});
+            count++;
+
+            // Indirect addressing goes through the templates
+            if (mode == Mode_IZX || mode == Mode_IZY || mode == Mode_IND)
+                kind = (kind == Kind_JMP) ? Kind_Exit : Kind_Helper;
+
+            switch (kind) {
+
+                case Kind_LDA: case Kind_LDX: case Kind_LDY: {
+                    int reg = kind == Kind_LDA ? AREG : kind == Kind_LDX ? XREG : YREG;
+                    operand(mode, value, next);
+                    e.rr(0x89, RAX, reg);
+                    result(reg);
+                    break;
+                }
+
+                case Kind_STA: case Kind_STX: {
+                    // STX wraps to the zero page
+                    int reg = kind == Kind_STA ? AREG : XREG;
+                    address(mode, value);
+                    if (kind == Kind_STX) e.rr(0x0FB6, RCX, RCX, false, true);
+                    result(reg);
+                    e.rr(0x89, reg, RSI);
+                    write(next, cycles);
+                    break;
+                }
+
+                case Kind_STY: {
+                    // Loads Y from the zero page
+                    address(mode, value);
+                    e.rr(0x0FB6, RCX, RCX, false, true);
+                    read(next);
+                    e.rr(0x89, RAX, YREG);
+                    result(YREG);
+                    break;
+                }
+
+                case Kind_AND: case Kind_ORA: case Kind_EOR: {
+                    operand(mode, value, next);
+                    e.rr(kind == Kind_AND ? 0x21 : kind == Kind_ORA ? 0x09 : 0x31, RAX, AREG);
+                    result(AREG);
+                    break;
+                }
+
+                case Kind_ADC: {
+                    operand(mode, value, next);
+                    e.bt(PREG, 0);                                      // CF = C
+                    e.rr(0x10, RAX, AREG, false, true);                 // adc r12b, al
+                    e.setcc(CondB, RAX);
+                    e.setcc(CondO, RDX);
+                    e.aluImm(4, PREG, 0xFF & ~(FlagC | FlagV));
+                    e.rr(0x0FB6, RAX, RAX, false, true);
+                    e.rr(0x09, RAX, PREG);
+                    e.rr(0x0FB6, RDX, RDX, false, true);
+                    e.shiftImm(4, RDX, 5);
+                    e.rr(0x09, RDX, PREG);
+                    result(AREG);
+                    break;
+                }
+
+                case Kind_CMP: case Kind_CPX: case Kind_CPY: {
+                    int reg = kind == Kind_CMP ? AREG : kind == Kind_CPX ? XREG : YREG;
+                    operand(mode, value, next);
+                    e.rr(0x38, RAX, reg, false, true);                  // cmp reg8, al
+                    e.setcc(CondAE, RDX);
+                    e.aluImm(4, PREG, 0xFF & ~FlagC);
+                    e.rr(0x0FB6, RDX, RDX, false, true);
+                    e.rr(0x09, RDX, PREG);
+                    e.rr(0x89, reg, NZREG);
+                    e.rr(0x29, RAX, NZREG);                             // sub ebp, eax
+                    e.rr(0x0FB6, NZREG, NZREG, false, true);
+                    lazy = true;
+                    break;
+                }
+
+                case Kind_INX: case Kind_INY: case Kind_DEX: case Kind_DEY: {
+                    int reg = (kind == Kind_INX || kind == Kind_DEX) ? XREG : YREG;
+                    e.incdec8((kind == Kind_INX || kind == Kind_INY) ? 0 : 1, reg);
+                    result(reg);
+                    break;
+                }
+
+                case Kind_TAX: e.rr(0x89, AREG, XREG); result(XREG); break;
+                case Kind_TAY: e.rr(0x89, AREG, YREG); result(YREG); break;
+                case Kind_TXA: e.rr(0x89, XREG, AREG); result(AREG); break;
+                case Kind_TYA: e.rr(0x89, YREG, AREG); result(AREG); break;
+
+                case Kind_CLC: e.aluImm(4, PREG, 0xFF & ~FlagC); break;
+                case Kind_CLD: e.aluImm(4, PREG, 0xFF & ~FlagD); break;
+                case Kind_CLI: e.aluImm(4, PREG, 0xFF & ~FlagI); break;
+                case Kind_CLV: e.aluImm(4, PREG, 0xFF & ~FlagV); break;
+                case Kind_SEC: e.aluImm(1, PREG, FlagC); break;
+                case Kind_SED: e.aluImm(1, PREG, FlagD); break;
+                case Kind_SEI: e.aluImm(1, PREG, FlagI); break;
+
+                case Kind_NOP: break;
+
+                case Kind_JMP: {
+                    // Keep translating at the target
+                    checks(value, cycles);
+                    pc = value;
+                    continue;
+                }
+
+                case Kind_BCC: case Kind_BCS: case Kind_BVC: case Kind_BVS:
+                case Kind_BEQ: case Kind_BNE: case Kind_BMI: case Kind_BPL: {
+                    int cond;
+
+                    switch (kind) {
+                        case Kind_BCC: e.testImm(PREG, FlagC); cond = CondE; break;
+                        case Kind_BCS: e.testImm(PREG, FlagC); cond = CondNE; break;
+                        case Kind_BVC: e.testImm(PREG, FlagV); cond = CondE; break;
+                        case Kind_BVS: e.testImm(PREG, FlagV); cond = CondNE; break;
+                        case Kind_BEQ:
+                        case Kind_BNE:
+                            if (lazy) {
+                                e.rr(0x85, NZREG, NZREG);
+                                cond = kind == Kind_BEQ ? CondE : CondNE;
+                            } else {
+                                e.testImm(PREG, FlagZ);
+                                cond = kind == Kind_BEQ ? CondNE : CondE;
+                            }
+                            break;
+                        default:
+                            if (lazy) e.testImm(NZREG, 0x80);
+                            else e.testImm(PREG, FlagN);
+                            cond = kind == Kind_BMI ? CondNE : CondE;
+                            break;
+                    }
+
+                    // Taken costs a cycle more, and another landing on a different page
+                    uint16_t target = next + (int8_t)value;
+                    uint8_t takenCycles = cycles + 1 + ((next ^ target) > 0xFF);
+                    takens.push_back((Taken){e.jcc(cond), target, lazy, takenCycles});
+                    break;
+                }
+
+                case Kind_Exit:
+                case Kind_Helper: {
+                    sync(next);
+                    e.rr(0x89, CPUREG, RDI, true);
+                    e.movImm32(RSI, value);
+                    e.call((const void *)Core6502::decodedOperations[opCode]);
+                    reload();
+
+                    // Page crossing cycles the operation left behind
+                    if (mode == Mode_ABX || mode == Mode_ABY || mode == Mode_IZY) {
+                        e.rm(0x0FB6, RAX, CPUREG, layout.extraCycles);
+                        e.rm(0x29, RAX, RSP, BUDGET);
+                        e.rm(0xC6, 0, CPUREG, layout.extraCycles);      // mov byte [rbx + extraCycles], 0
+                        e.byte(0);
+                    }
+
+                    if (kind == Kind_Exit) {
+                        // PC was set by the operation
+                        e.aluMemImm(5, RSP, BUDGET, cycles);
+                        dynamicExits.push_back(e.jmp());
+                        linked = true;
+                        break;
+                    }
+
+                    checkInvalidated(next, cycles);
+
+                    // PLP into decimal mode leaves for the interpreter
+                    if (opCode == 0x28) {
+                        e.testImm(PREG, FlagD);
+                        exitIf(CondNE, next, cycles);
+                    }
+                    break;
+                }
+            }
+
+            if (linked) break;
+
+            checks(next, cycles);
+            pc = next;
+
+            // Decimal mode always runs on the interpreter
+            if (kind == Kind_SED) break;
+
+        }
+
+        // Ran out of trace, carry on from pc next time
+        if (!linked) exitTo(pc, 0);
+
+        // Taken branches
+        for (size_t i = 0; i < takens.size(); i++) {
+            const Taken & taken = takens[i];
+
+            e.patch(taken.fixup, e.size);
+            lazy = taken.lazy;
+            checks(taken.target, taken.cycles);
+            if (!jumpTo(taken.target)) exitTo(taken.target, 0);
+        }
+
+        // Exit stubs
+        std::vector<size_t> toEpilogue = dynamicExits;
+
+        for (size_t i = 0; i < exits.size(); i++) {
+            const Exit & exit = exits[i];
+
+            e.patch(exit.fixup, e.size);
+            if (exit.cycles) e.aluMemImm(5, RSP, BUDGET, exit.cycles);
+
+            lazy = exit.lazy;
+            settle();
+
+            e.byte(0x66);
+            e.rm(0xC7, 0, CPUREG, layout.PC);
+            e.word(exit.pc);
+
+            toEpilogue.push_back(e.jmp());
+        }
+
+        for (size_t i = 0; i < toEpilogue.size(); i++) e.patch(toEpilogue[i], e.size);
+        epilogue();
+
+        return count;
+
+    }
+
+}
+
+Core6502::JIT::JIT(Core6502::CPU & cpu) : cpu(cpu), bus(cpu.bus) {
+
+    translations = 0;
+    entries = 0;
+    invalidated = false;
+    codeUsed = 0;
+
+    traces = new Trace[0x10000];
+    // Never writable and executable at once, compile() opens it for writing.  Systems that
+    // refuse executable mappings leave the JIT unavailable and the CPU on the switch core.
+    code = (uint8_t *)mmap(NULL, CodeSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (code == (uint8_t *)MAP_FAILED) code = NULL;
+    if (code && mprotect(code, CodeSize, PROT_READ | PROT_EXEC) != 0) {
+        munmap(code, CodeSize);
+        code = NULL;
+    }
+
+    // Emitted code assumes the usual LSB first bitfield layout
+    decltype(cpu.status) probe;
+    probe.raw = 0;
+    probe.bitfield.NegativeFlag = 1;
+    probe.bitfield.OverflowFlag = 1;
+    probe.bitfield.ZeroFlag = 1;
+    if (probe.raw != (FlagN | FlagV | FlagZ) && code) {
+        munmap(code, CodeSize);
+        code = NULL;
+    }
+
+    trap = code ? bus.addWriteTrap(codeWritten, this) : -1;
+
+    flush();
+
+}
+
+Core6502::JIT::~JIT() {
+
+    if (trap >= 0) bus.removeWriteTrap(trap);
+    if (code) munmap(code, CodeSize);
+    delete [] traces;
+
+}
+
+bool Core6502::JIT::available() const {
+    return code != NULL && trap >= 0;
+}
+
+void Core6502::JIT::flush() {
+
+    memset(traces, 0, sizeof(Trace) * 0x10000);
+
+    for (int page = 0; page < 0x100; page++) {
+        pageTraces[page].clear();
+        pageRewrites[page] = 0;
+        if (trap >= 0) bus.untrapPage(trap, page);
+    }
+
+    codeUsed = 0;
+    mapGeneration = bus.mapGeneration;
+    invalidated = true;
+
+}
+
+bool Core6502::JIT::cacheable(uint8_t page) const {
+    return bus.readPage[page] && pageRewrites[page] < CORE6502_MAX_PAGE_REWRITES;
+}
+
+Core6502::JIT::Trace Core6502::JIT::lookup(uint16_t pc) {
+
+    // Any remap may have changed what's behind translated code
+    if (bus.mapGeneration != mapGeneration) flush();
+
+    Trace trace = traces[pc];
+    if (trace || !available() || !cacheable(pc >> 8)) return trace;
+
+    return compile(pc);
+
+}
+
+Core6502::JIT::Trace Core6502::JIT::compile(uint16_t pc) {
+
+    struct Check {
+        static bool cacheable(void * context, uint8_t page) {
+            return ((Core6502::JIT *)context)->cacheable(page);
+        }
+    };
+
+    Layout layout;
+    layout.PC = (int32_t)((uint8_t *)&cpu.registers.PC - (uint8_t *)&cpu);
+    layout.A = (int32_t)((uint8_t *)&cpu.registers.A - (uint8_t *)&cpu);
+    layout.X = (int32_t)((uint8_t *)&cpu.registers.X - (uint8_t *)&cpu);
+    layout.Y = (int32_t)((uint8_t *)&cpu.registers.Y - (uint8_t *)&cpu);
+    layout.P = (int32_t)((uint8_t *)&cpu.status.raw - (uint8_t *)&cpu);
+    layout.extraCycles = (int32_t)((uint8_t *)&cpu.extraCycles - (uint8_t *)&cpu);
+    layout.readPage = (int32_t)((uint8_t *)bus.readPage - (uint8_t *)&cpu);
+    layout.writePage = (int32_t)((uint8_t *)bus.writePage - (uint8_t *)&cpu);
+
+    // No trace runs while one is compiled, so the arena can stop being executable
+    if (mprotect(code, CodeSize, PROT_READ | PROT_WRITE) != 0) return NULL;
+
+    Trace trace = NULL;
+
+    // Start over with an empty arena once it fills up
+    for (int attempt = 0; attempt < 2 && !trace; attempt++) {
+
+        Emitter e(code + codeUsed, CodeSize - codeUsed);
+        TraceCompiler compiler(e, layout, bus, &invalidated);
+
+        int count = compiler.compile(pc, Check::cacheable, this);
+        if (!count) break;
+
+        if (e.full) {
+            flush();
+            continue;
+        }
+
+        trace = (Trace)(code + codeUsed);
+        codeUsed = (codeUsed + e.size + 15) & ~(size_t)15;
+
+        for (int i = 0; i < compiler.pageCount; i++) {
+            pageTraces[compiler.pages[i]].push_back(pc);
+            bus.trapPage(trap, compiler.pages[i]);
+        }
+
+        traces[pc] = trace;
+        translations++;
+
+    }
+
+    // Without a way back to executable, give up on translating and let the interpreter run
+    if (mprotect(code, CodeSize, PROT_READ | PROT_EXEC) != 0) {
+        flush();
+        munmap(code, CodeSize);
+        code = NULL;
+        return NULL;
+    }
+
+    return trace;
+
+}
+
+void Core6502::JIT::codeWritten(void * context, uint16_t addr, uint8_t value) {
+
+    Core6502::JIT & jit = *(Core6502::JIT *)context;
+    uint8_t page = addr >> 8;
+
+    // Forget every trace reading code from the page.  Code already running stays mapped
+    // and leaves at its next invalidation check.
+    std::vector<uint16_t> & starts = jit.pageTraces[page];
+    for (size_t i = 0; i < starts.size(); i++) jit.traces[starts[i]] = NULL;
+    starts.clear();
+
+    if (jit.pageRewrites[page] < CORE6502_MAX_PAGE_REWRITES) jit.pageRewrites[page]++;
+    jit.bus.untrapPage(jit.trap, page);
+
+    jit.invalidated = true;
+
+}
+
+uint32_t Core6502::JIT::run(uint32_t cycles, int32_t stopPC) {
+
+    uint32_t elapsed = 0;
+
+    while (elapsed < cycles && cpu.registers.PC != stopPC) {
+
+        // Untranslatable code, and anything in decimal mode, runs an instruction at a time
+        Trace trace = cpu.status.bitfield.DecimalMode ? NULL : lookup(cpu.registers.PC);
+
+        if (!trace) {
+            uint8_t opCode = cpu.fetchByte();
+            Core6502::specializedOperations[opCode](cpu);
+            elapsed += cycleCounts[opCode] + cpu.extraCycles;
+            cpu.extraCycles = 0;
+            continue;
+        }
+
+        int32_t budget = (cycles - elapsed > CORE6502_MAX_TRACE_BUDGET) ? CORE6502_MAX_TRACE_BUDGET : cycles - elapsed;
+
+        invalidated = false;
+        entries++;
+
+        elapsed += budget - trace(&cpu, budget, stopPC);
+
+    }
+
+    return elapsed;
+
+}
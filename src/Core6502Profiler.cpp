@@ -0,0 +1,190 @@
+//
+//  Core6502Profiler.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include "Core6502Profiler.hpp"
+
+static const char * const mnemonics[0x100] = {
+#define CORE6502_OPCODE(opCode, cycles, operation, addressing) #operation " " #addressing,
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+};
+
+// Opcodes that enter and leave guest functions
+static const uint8_t opJSR = 0x20;
+static const uint8_t opBRK = 0x00;
+static const uint8_t opRTS = 0x60;
+static const uint8_t opRTI = 0x40;
+
+Core6502::Profiler::Profiler() {
+    addresses = new Counts[0x10000];
+    clear();
+}
+
+Core6502::Profiler::~Profiler() {
+    delete[] addresses;
+}
+
+void Core6502::Profiler::clear() {
+
+    memset(opcodes, 0, sizeof(opcodes));
+    memset(addresses, 0, 0x10000 * sizeof(Counts));
+
+    Node root = {0, 0, 0};
+    nodes.assign(1, root);
+    children.clear();
+    frames.clear();
+    current = 0;
+
+    base = 0;
+    started = false;
+    pending = false;
+
+}
+
+uint64_t Core6502::Profiler::instructions() const {
+
+    uint64_t total = 0;
+    for (int i = 0; i < 0x100; i++) total += opcodes[i].executions;
+    return total;
+
+}
+
+uint64_t Core6502::Profiler::cycles() const {
+
+    uint64_t total = 0;
+    for (int i = 0; i < 0x100; i++) total += opcodes[i].cycles;
+    return total;
+
+}
+
+void Core6502::Profiler::finish(const Core6502::CPU & cpu) {
+
+    // The last instruction ends where the CPU's clock will be once it's fully clocked
+    if (pending) settle(cpu.registers.PC, cpu.registers.SP, cpu.totalCycles + cpu.cyclesRemaining);
+    pending = false;
+
+}
+
+void Core6502::Profiler::start(uint16_t pc) {
+    nodes[0].function = pc;
+    started = true;
+}
+
+// Charges the pending instruction with the cycles up to the one at pc, then follows it into
+// or out of a call
+void Core6502::Profiler::settle(uint16_t pc, uint8_t sp, uint64_t cycle) {
+
+    uint64_t used = cycle - lastCycle;
+    opcodes[lastOpCode].cycles += used;
+    addresses[lastPC].cycles += used;
+    nodes[current].cycles += used;
+
+    if (lastOpCode == opJSR || lastOpCode == opBRK) {
+
+        Frame frame = {current, lastSP};
+        frames.push_back(frame);
+
+        uint64_t key = (uint64_t)current << 16 | pc;
+        std::unordered_map<uint64_t, uint32_t>::iterator child = children.find(key);
+        if (child == children.end()) {
+            Node node = {pc, current, 0};
+            nodes.push_back(node);
+            child = children.insert(std::make_pair(key, (uint32_t)(nodes.size() - 1))).first;
+        }
+        current = child->second;
+
+    } else if (lastOpCode == opRTS || lastOpCode == opRTI) {
+
+        // Back to the caller whose stack pointer we're at again.  Returns from interrupts
+        // that weren't followed in leave SP below the caller's and change nothing.
+        while (!frames.empty() && sp >= frames.back().SP) {
+            current = frames.back().node;
+            frames.pop_back();
+        }
+
+    }
+
+}
+
+// Index/counts pair for sorting by cycles, then executions, then index
+struct Entry {
+    uint32_t index;
+    Core6502::Profiler::Counts counts;
+
+    bool operator<(const Entry & other) const {
+        if (counts.cycles != other.counts.cycles) return counts.cycles > other.counts.cycles;
+        if (counts.executions != other.counts.executions) return counts.executions > other.counts.executions;
+        return index < other.index;
+    }
+};
+
+static void sortedEntries(const Core6502::Profiler::Counts * counts, uint32_t length, std::vector<Entry> & entries) {
+
+    entries.clear();
+    for (uint32_t i = 0; i < length; i++) {
+        if (!counts[i].executions) continue;
+        Entry entry = {i, counts[i]};
+        entries.push_back(entry);
+    }
+
+    std::sort(entries.begin(), entries.end());
+
+}
+
+void Core6502::Profiler::writeFlat(std::ostream & out) const {
+
+    uint64_t total = cycles();
+    double scale = total ? 100.0 / total : 0;
+    std::vector<Entry> entries;
+    char line[96];
+
+    snprintf(line, sizeof(line), "# %llu instructions, %llu cycles\n",
+             (unsigned long long)instructions(), (unsigned long long)total);
+    out << line;
+
+    out << "#\n#  cycles       %      executions  opcode\n";
+    sortedEntries(opcodes, 0x100, entries);
+    for (size_t i = 0; i < entries.size(); i++) {
+        const Entry & entry = entries[i];
+        snprintf(line, sizeof(line), "%12llu  %6.2f  %14llu  %02X %s\n",
+                 (unsigned long long)entry.counts.cycles, entry.counts.cycles * scale,
+                 (unsigned long long)entry.counts.executions, entry.index, mnemonics[entry.index]);
+        out << line;
+    }
+
+    out << "#\n#  cycles       %      executions  address\n";
+    sortedEntries(addresses, 0x10000, entries);
+    for (size_t i = 0; i < entries.size(); i++) {
+        const Entry & entry = entries[i];
+        snprintf(line, sizeof(line), "%12llu  %6.2f  %14llu  $%04X\n",
+                 (unsigned long long)entry.counts.cycles, entry.counts.cycles * scale,
+                 (unsigned long long)entry.counts.executions, entry.index);
+        out << line;
+    }
+
+}
+
+void Core6502::Profiler::writeFolded(std::ostream & out) const {
+
+    // Nodes are only added below ones that exist already, so each parent's stack string is
+    // built before its children's
+    std::vector<std::string> stacks(nodes.size());
+    char name[8];
+
+    for (size_t i = 0; i < nodes.size(); i++) {
+        snprintf(name, sizeof(name), "$%04X", nodes[i].function);
+        stacks[i] = i ? stacks[nodes[i].parent] + ";" + name : std::string(name);
+
+        if (!nodes[i].cycles) continue;
+        out << stacks[i] << " " << nodes[i].cycles << "\n";
+    }
+
+}
@@ -0,0 +1,287 @@
+//
+//  Core6502Replay.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include <string.h>
+#include "Core6502.hpp"
+#include "Core6502Replay.hpp"
+#include "Core6502SaveState.hpp"
+
+static const char magic[4] = {'C', '6', '5', 'R'};
+
+static void putVarint(std::ostream & out, uint64_t value) {
+
+    uint8_t data[10];
+    int length = 0;
+
+    do {
+        data[length] = value & 0x7F;
+        value >>= 7;
+        if (value) data[length] |= 0x80;
+        length++;
+    } while (value);
+
+    out.write((const char *)data, length);
+
+}
+
+static bool getVarint(std::istream & in, uint64_t & value) {
+
+    value = 0;
+
+    for (int shift = 0; shift < 70; shift += 7) {
+        int byte = in.get();
+        if (byte == EOF) return false;
+
+        value |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+
+    return false;
+
+}
+
+Core6502::Recorder::Recorder(Core6502::CPU & cpu, std::ostream & out, const uint8_t * base) : cpu(cpu), out(out) {
+
+    events = 0;
+    lastCycle = cpu.totalCycles;
+    finished = false;
+
+    out.write(magic, sizeof(magic));
+    out.put(Core6502::Replay::Version);
+    for (int i = 0; i < 3; i++) out.put(0);
+    Core6502::SaveState::write(out, cpu, base);
+
+    cpu.recorder = this;
+    cpu.bus.input = input;
+    cpu.bus.inputContext = this;
+
+}
+
+Core6502::Recorder::~Recorder() {
+    finish();
+}
+
+bool Core6502::Recorder::good() const {
+    return (bool)out;
+}
+
+void Core6502::Recorder::event(Core6502::Replay::Event event) {
+
+    out.put(event);
+    putVarint(out, cpu.totalCycles - lastCycle);
+    lastCycle = cpu.totalCycles;
+
+}
+
+void Core6502::Recorder::interrupt(Core6502::Replay::Event event) {
+
+    this->event(event);
+    events++;
+
+}
+
+void Core6502::Recorder::finish() {
+
+    if (finished) return;
+    finished = true;
+
+    event(Core6502::Replay::End);
+    out.flush();
+
+    cpu.recorder = NULL;
+    cpu.bus.input = NULL;
+    cpu.bus.inputContext = NULL;
+
+}
+
+uint8_t Core6502::Recorder::input(void * context, uint16_t addr, const Core6502::Bus::Handler & handler) {
+
+    Core6502::Recorder & recorder = *(Core6502::Recorder *)context;
+    uint8_t value = handler.read ? handler.read(handler.context, addr) : 0;
+
+    recorder.event(Core6502::Replay::Read);
+    recorder.out.put(addr & 0xFF);
+    recorder.out.put(addr >> 8);
+    recorder.out.put(value);
+    recorder.events++;
+
+    return value;
+
+}
+
+Core6502::Replayer::Replayer(Core6502::CPU & cpu, std::istream & in, const uint8_t * base) : cpu(cpu), in(in) {
+
+    error = NULL;
+    events = 0;
+    running = false;
+    pending = false;
+    ended = false;
+
+    char header[8];
+    if (!in.read(header, sizeof(header)) || memcmp(header, magic, sizeof(magic)) != 0)
+        error = "not a replay log";
+    else if ((uint8_t)header[4] > Core6502::Replay::Version)
+        error = "newer log version";
+    else if (!Core6502::SaveState::read(in, cpu, base))
+        error = "bad start state";
+
+    lastCycle = cpu.totalCycles;
+
+    cpu.bus.input = input;
+    cpu.bus.inputContext = this;
+
+}
+
+Core6502::Replayer::~Replayer() {
+
+    cpu.bus.input = NULL;
+    cpu.bus.inputContext = NULL;
+
+}
+
+// Next event's type and cycle, and its address and value for a read
+bool Core6502::Replayer::next(uint8_t & type, uint64_t & cycle, Input & read) {
+
+    int byte = in.get();
+    uint64_t delta;
+    if (byte == EOF || !getVarint(in, delta)) {
+        error = "log cut short";
+        return false;
+    }
+
+    type = byte;
+    cycle = lastCycle + delta;
+    lastCycle = cycle;
+
+    if (type == Core6502::Replay::Read) {
+        uint8_t data[3];
+        if (!in.read((char *)data, sizeof(data))) {
+            error = "log cut short";
+            return false;
+        }
+        read.addr = data[0] | data[1] << 8;
+        read.value = data[2];
+    } else if (type > Core6502::Replay::NMI) {
+        error = "unknown event";
+        return false;
+    }
+
+    return true;
+
+}
+
+// Runs up to cycle.  At an event, every read logged before it must have been made.
+bool Core6502::Replayer::runTo(uint64_t cycle, bool event) {
+
+    if (cycle < cpu.totalCycles) {
+        error = "event before the CPU's cycle";
+        return false;
+    }
+
+    running = true;
+    while (!error && cpu.totalCycles < cycle) {
+        uint64_t remaining = cycle - cpu.totalCycles;
+        cpu.run(remaining > 0x7FFFFFFF ? 0x7FFFFFFF : (uint32_t)remaining);
+    }
+    running = false;
+
+    if (event && !error && !reads.empty()) error = "CPU made fewer reads than logged";
+
+    return !error;
+
+}
+
+// Replays events up to until, returning at until or End
+bool Core6502::Replayer::play(uint64_t until) {
+
+    while (!error && !ended) {
+
+        if (!pending) {
+            Input read;
+            if (!next(pendingType, pendingCycle, read)) break;
+
+            if (pendingType == Core6502::Replay::Read) {
+                reads.push_back(read);
+                continue;
+            }
+            pending = true;
+        }
+
+        // Reads before the next event that come after until stay queued for the next call
+        if (pendingCycle > until) return runTo(until, false);
+
+        if (!runTo(pendingCycle, true)) break;
+        pending = false;
+
+        if (pendingType == Core6502::Replay::End) {
+            ended = true;
+            return true;
+        }
+
+        events++;
+        if (pendingType == Core6502::Replay::IRQ) cpu.irq();
+        else cpu.nmi();
+
+    }
+
+    return false;
+
+}
+
+bool Core6502::Replayer::run() {
+    return play(UINT64_MAX);
+}
+
+bool Core6502::Replayer::seek(uint64_t cycle) {
+
+    if (error) return false;
+
+    if (cycle < cpu.totalCycles || ended) {
+        error = "seek outside the log";
+        return false;
+    }
+
+    if (!play(cycle)) return false;
+
+    if (cpu.totalCycles != cycle) {
+        error = "seek outside the log";
+        return false;
+    }
+
+    return true;
+
+}
+
+uint8_t Core6502::Replayer::input(void * context, uint16_t addr, const Core6502::Bus::Handler & handler) {
+
+    Core6502::Replayer & replayer = *(Core6502::Replayer *)context;
+    if (replayer.error) return 0;
+
+    Input read;
+
+    if (!replayer.reads.empty()) {
+        read = replayer.reads.front();
+        replayer.reads.pop_front();
+    } else {
+        // Reads inside irq()/nmi() come straight after the interrupt in the log.  Mid-run, the
+        // log has moved on to the next event, so the CPU has diverged.
+        uint8_t type;
+        uint64_t cycle;
+        if (replayer.running) replayer.error = "CPU made more reads than logged";
+        else if (replayer.next(type, cycle, read) && type != Core6502::Replay::Read) replayer.error = "CPU made more reads than logged";
+        if (replayer.error) return 0;
+    }
+
+    if (read.addr != addr) {
+        replayer.error = "read address differs from the log";
+        return 0;
+    }
+
+    replayer.events++;
+    return read.value;
+
+}
@@ -0,0 +1,234 @@
+//
+//  Core6502Rewind.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include <string.h>
+#include "Core6502.hpp"
+#include "Core6502Rewind.hpp"
+#include "Core6502Replay.hpp"
+#include "Core6502Scheduler.hpp"
+
+Core6502::Rewind::Rewind(Core6502::CPU & cpu, Core6502::Scheduler & scheduler, uint32_t interval, size_t budget) : cpu(cpu), scheduler(scheduler) {
+
+    this->interval = interval ? interval : 1;
+    this->budget = budget;
+
+    error = NULL;
+    checkpoints = 0;
+    dropped = 0;
+
+    base.assign(cpu.mem, cpu.mem + 0x10000);
+    finishedSize = 0;
+    recorder = NULL;
+
+    present = 0;
+    savedScheduler = NULL;
+    savedDebugger = NULL;
+
+    checkpoint();
+    timer = scheduler.schedule(cpu.totalCycles + this->interval, checkpointDue, this);
+
+}
+
+Core6502::Rewind::~Rewind() {
+
+    // Leave the CPU where it was found, even if the way back failed
+    if (!live() && !resume()) {
+        cpu.scheduler = savedScheduler;
+        cpu.debugger = savedDebugger;
+    }
+
+    scheduler.cancel(timer);
+
+    if (recorder) {
+        recorder->finish();
+        delete recorder;
+    }
+
+}
+
+uint64_t Core6502::Rewind::earliest() const {
+    return segments.front().start;
+}
+
+uint64_t Core6502::Rewind::latest() const {
+    return live() ? cpu.totalCycles : present;
+}
+
+size_t Core6502::Rewind::size() const {
+    return finishedSize + (live() ? (size_t)log.tellp() : 0);
+}
+
+// Starts a segment, its checkpoint being the Recorder's start state
+void Core6502::Rewind::checkpoint() {
+
+    log.str("");
+    log.clear();
+
+    segments.push_back((Segment){cpu.totalCycles, std::string()});
+    recorder = new Core6502::Recorder(cpu, log, base.data());
+    checkpoints++;
+
+}
+
+void Core6502::Rewind::finishSegment() {
+
+    recorder->finish();
+    delete recorder;
+    recorder = NULL;
+
+    segments.back().log = log.str();
+    finishedSize += segments.back().log.size();
+    log.str("");
+
+}
+
+// Drops the oldest segments over budget, always keeping the newest
+void Core6502::Rewind::trim() {
+
+    while (segments.size() > 1 && size() > budget) {
+        finishedSize -= segments.front().log.size();
+        segments.pop_front();
+        dropped++;
+    }
+
+}
+
+void Core6502::Rewind::checkpointDue(Core6502::CPU & cpu, uint64_t cycle, void * context) {
+
+    Core6502::Rewind & rewind = *(Core6502::Rewind *)context;
+
+    rewind.finishSegment();
+    rewind.checkpoint();
+    rewind.trim();
+
+    rewind.timer = rewind.scheduler.schedule(cycle + rewind.interval, checkpointDue, &rewind);
+
+}
+
+// Stops recording and detaches what mustn't see the past
+void Core6502::Rewind::leave() {
+
+    present = cpu.totalCycles;
+    finishSegment();
+
+    savedScheduler = cpu.scheduler;
+    savedDebugger = cpu.debugger;
+    cpu.scheduler = NULL;
+    cpu.debugger = NULL;
+
+}
+
+// Newest segment whose checkpoint is at or before cycle
+size_t Core6502::Rewind::segmentAt(uint64_t cycle) const {
+
+    size_t segment = segments.size() - 1;
+    while (segment && segments[segment].start > cycle) segment--;
+
+    return segment;
+
+}
+
+// Loads segment's checkpoint and replays up to cycle.  With boundary, goes a cycle at a time
+// and sets it to the last instruction boundary before cycle, leaving it alone if none.
+bool Core6502::Rewind::replay(size_t segment, uint64_t cycle, uint64_t * boundary) {
+
+    // Devices see nothing: reads come from the log and writes to I/O are dropped
+    Core6502::Bus::Handler handlers[0x100];
+    memcpy(handlers, cpu.bus.handlers, sizeof(handlers));
+    for (int page = 0; page < 0x100; page++) cpu.bus.handlers[page].write = NULL;
+
+    std::istringstream in(segments[segment].log);
+    Core6502::Replayer replayer(cpu, in, base.data());
+
+    if (boundary && replayer.good()) {
+        for (uint64_t at = cpu.totalCycles; at < cycle; ) {
+            if (!cpu.cyclesRemaining) *boundary = at;
+            if (!replayer.seek(++at)) break;
+        }
+    } else if (replayer.good()) {
+        replayer.seek(cycle);
+    }
+
+    error = replayer.error;
+
+    memcpy(cpu.bus.handlers, handlers, sizeof(handlers));
+
+    return !error;
+
+}
+
+bool Core6502::Rewind::seek(uint64_t cycle) {
+
+    error = NULL;
+
+    if (cycle < earliest() || cycle > latest()) {
+        error = "cycle outside the history";
+        return false;
+    }
+
+    if (live()) {
+        if (cycle == cpu.totalCycles) return true;
+        leave();
+    }
+
+    if (cycle == present) return resume();
+
+    return replay(segmentAt(cycle), cycle, NULL);
+
+}
+
+bool Core6502::Rewind::stepBack() {
+
+    error = NULL;
+
+    uint64_t now = cpu.totalCycles;
+    if (now <= earliest()) {
+        error = "no earlier instruction";
+        return false;
+    }
+
+    if (live()) leave();
+
+    // An instruction can straddle a checkpoint, so look back through earlier segments until
+    // one has a boundary
+    uint64_t boundary = UINT64_MAX;
+    for (size_t segment = segmentAt(now - 1); boundary == UINT64_MAX; segment--) {
+
+        uint64_t end = segment + 1 < segments.size() ? segments[segment + 1].start : present;
+        if (end > now) end = now;
+        if (!replay(segment, end, &boundary)) return false;
+
+        if (!segment) break;
+
+    }
+
+    if (boundary == UINT64_MAX) {
+        replay(segmentAt(now), now, NULL);
+        error = "no earlier instruction";
+        return false;
+    }
+
+    return replay(segmentAt(boundary), boundary, NULL);
+
+}
+
+bool Core6502::Rewind::resume() {
+
+    error = NULL;
+    if (live()) return true;
+
+    if (cpu.totalCycles != present && !replay(segmentAt(present), present, NULL)) return false;
+
+    cpu.scheduler = savedScheduler;
+    cpu.debugger = savedDebugger;
+
+    checkpoint();
+    trim();
+
+    return true;
+
+}
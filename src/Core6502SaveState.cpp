@@ -0,0 +1,251 @@
+//
+//  Core6502SaveState.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include <string.h>
+#include <vector>
+#include "Core6502.hpp"
+#include "Core6502SaveState.hpp"
+
+static const char magic[4] = {'C', '6', '5', '2'};
+static const uint32_t memorySize = 0x10000;
+static const uint32_t minimumRun = 4;      // Shorter repeats stay in literals
+
+static void putLE(std::ostream & out, uint64_t value, int bytes) {
+
+    uint8_t data[8];
+    for (int i = 0; i < bytes; i++) data[i] = (uint8_t)(value >> (i * 8));
+    out.write((const char *)data, bytes);
+
+}
+
+static bool getLE(std::istream & in, uint64_t & value, int bytes) {
+
+    uint8_t data[8];
+    if (!in.read((char *)data, bytes)) return false;
+
+    value = 0;
+    for (int i = 0; i < bytes; i++) value |= (uint64_t)data[i] << (i * 8);
+    return true;
+
+}
+
+static void putVarint(std::ostream & out, uint32_t value) {
+
+    uint8_t data[5];
+    int length = 0;
+
+    do {
+        data[length] = value & 0x7F;
+        value >>= 7;
+        if (value) data[length] |= 0x80;
+        length++;
+    } while (value);
+
+    out.write((const char *)data, length);
+
+}
+
+static bool getVarint(std::istream & in, uint32_t & value) {
+
+    value = 0;
+
+    for (int shift = 0; shift < 35; shift += 7) {
+        int byte = in.get();
+        if (byte == EOF) return false;
+
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+
+    return false;
+
+}
+
+// Memory byte as stored, XORed against the base when there is one
+static inline uint8_t stored(const uint8_t * mem, const uint8_t * base, uint32_t i) {
+    return base ? mem[i] ^ base[i] : mem[i];
+}
+
+// Eight stored bytes at i
+static inline uint64_t storedWord(const uint8_t * mem, const uint8_t * base, uint32_t i) {
+
+    uint64_t word, baseWord = 0;
+    memcpy(&word, mem + i, 8);
+    if (base) memcpy(&baseWord, base + i, 8);
+
+    return word ^ baseWord;
+
+}
+
+// Length of the run of equal stored bytes starting at i
+static uint32_t runLength(const uint8_t * mem, const uint8_t * base, uint32_t i) {
+
+    uint8_t value = stored(mem, base, i);
+    uint32_t end = i + 1;
+
+    // Whole words first, long zero runs are the common case
+    uint64_t pattern = value * 0x0101010101010101ull;
+    while (end + 8 <= memorySize && storedWord(mem, base, end) == pattern) end += 8;
+
+    while (end < memorySize && stored(mem, base, end) == value) end++;
+
+    return end - i;
+
+}
+
+static void writeLiteral(std::ostream & out, const uint8_t * mem, const uint8_t * base, uint32_t start, uint32_t length) {
+
+    putVarint(out, length << 1);
+
+    if (!base) {
+        out.write((const char *)mem + start, length);
+        return;
+    }
+
+    // XOR through a small buffer
+    uint8_t chunk[256];
+    while (length) {
+        uint32_t count = length < sizeof(chunk) ? length : sizeof(chunk);
+        for (uint32_t i = 0; i < count; i++) chunk[i] = mem[start + i] ^ base[start + i];
+        out.write((const char *)chunk, count);
+        start += count;
+        length -= count;
+    }
+
+}
+
+uint64_t Core6502::SaveState::hash(const uint8_t * base) {
+
+    // FNV-1a over 64 bit words, four interleaved streams to keep the multiplies independent
+    uint64_t lanes[4] = {0xCBF29CE484222325ull, 0x84222325CBF29CE4ull, 0xCBF29CE4ull, 0x84222325ull};
+
+    for (uint32_t i = 0; i < memorySize; i += 32) {
+        for (int lane = 0; lane < 4; lane++) {
+            uint64_t word;
+            memcpy(&word, base + i + lane * 8, 8);
+            lanes[lane] = (lanes[lane] ^ word) * 0x100000001B3ull;
+        }
+    }
+
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (int lane = 0; lane < 4; lane++) hash = (hash ^ lanes[lane]) * 0x100000001B3ull;
+
+    return hash;
+
+}
+
+bool Core6502::SaveState::write(std::ostream & out, const Core6502::CPU & cpu, const uint8_t * base) {
+
+    // Header
+    out.write(magic, sizeof(magic));
+    out.put(Version);
+    out.put(base ? DeltaFlag : 0);
+    putLE(out, 0, 2);
+    if (base) putLE(out, hash(base), 8);
+
+    // Registers
+    putLE(out, cpu.registers.PC, 2);
+    out.put(cpu.registers.SP);
+    out.put(cpu.registers.A);
+    out.put(cpu.registers.X);
+    out.put(cpu.registers.Y);
+    out.put(cpu.status.raw);
+    out.put(cpu.cyclesRemaining);
+    putLE(out, cpu.totalCycles, 8);
+
+    // Memory as runs and the literals between them
+    const uint8_t * mem = cpu.mem;
+    uint32_t literal = 0;
+    uint32_t i = 0;
+
+    while (i < memorySize) {
+        uint32_t run = runLength(mem, base, i);
+
+        if (run < minimumRun) {
+            i += run;
+            continue;
+        }
+
+        if (literal < i) writeLiteral(out, mem, base, literal, i - literal);
+
+        putVarint(out, (run << 1) | 1);
+        out.put(stored(mem, base, i));
+
+        i += run;
+        literal = i;
+    }
+
+    if (literal < memorySize) writeLiteral(out, mem, base, literal, memorySize - literal);
+
+    return (bool)out;
+
+}
+
+bool Core6502::SaveState::read(std::istream & in, Core6502::CPU & cpu, const uint8_t * base) {
+
+    uint64_t value;
+
+    // Header
+    char header[8];
+    if (!in.read(header, sizeof(header))) return false;
+    if (memcmp(header, magic, sizeof(magic)) != 0) return false;
+    if ((uint8_t)header[4] > Version) return false;
+
+    uint8_t flags = header[5];
+    if (flags & DeltaFlag) {
+        if (!base || !getLE(in, value, 8) || value != hash(base)) return false;
+    } else {
+        base = NULL;
+    }
+
+    // Registers
+    uint8_t registers[6];
+    uint64_t pc;
+    if (!getLE(in, pc, 2) || !in.read((char *)registers, sizeof(registers)) || !getLE(in, value, 8)) return false;
+
+    // Memory, decoded aside so a bad stream leaves the CPU as it was
+    std::vector<uint8_t> image(memorySize);
+    uint8_t * mem = image.data();
+    uint32_t i = 0;
+
+    while (i < memorySize) {
+        uint32_t token;
+        if (!getVarint(in, token)) return false;
+
+        uint32_t length = token >> 1;
+        if (length == 0 || length > memorySize - i) return false;
+
+        if (token & 1) {
+            int byte = in.get();
+            if (byte == EOF) return false;
+            memset(mem + i, byte, length);
+        } else {
+            if (!in.read((char *)mem + i, length)) return false;
+        }
+
+        if (base) for (uint32_t j = i; j < i + length; j++) mem[j] ^= base[j];
+
+        i += length;
+    }
+
+    memcpy(cpu.mem, mem, memorySize);
+
+    cpu.registers.PC = (uint16_t)pc;
+    cpu.registers.SP = registers[0];
+    cpu.registers.A = registers[1];
+    cpu.registers.X = registers[2];
+    cpu.registers.Y = registers[3];
+    cpu.status.raw = registers[4];
+    cpu.cyclesRemaining = registers[5];
+    cpu.totalCycles = value;
+
+    // Memory changed behind the bus
+    for (int page = 0; page < 0x100; page++) cpu.bus.invalidatePage(page);
+
+    return true;
+
+}
@@ -0,0 +1,106 @@
+//
+//  Core6502Scheduler.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include <algorithm>
+#include "Core6502.hpp"
+#include "Core6502Scheduler.hpp"
+
+Core6502::Scheduler::Scheduler() {
+
+    fired = 0;
+    nextID = 0;
+
+}
+
+// Heap order, std::push_heap keeps the event that compares greatest on top
+bool Core6502::Scheduler::later(const Event & a, const Event & b) {
+    return a.cycle != b.cycle ? a.cycle > b.cycle : a.id > b.id;
+}
+
+uint32_t Core6502::Scheduler::schedule(uint64_t cycle, Callback callback, void * context) {
+
+    Event event = {cycle, nextID++, callback, context};
+    events.push_back(event);
+    std::push_heap(events.begin(), events.end(), later);
+
+    return event.id;
+
+}
+
+uint32_t Core6502::Scheduler::scheduleIn(const Core6502::CPU & cpu, uint64_t delay, Callback callback, void * context) {
+    return schedule(cpu.totalCycles + delay, callback, context);
+}
+
+bool Core6502::Scheduler::cancel(uint32_t id) {
+
+    for (size_t i = 0; i < events.size(); i++) {
+        if (events[i].id != id) continue;
+
+        events[i] = events.back();
+        events.pop_back();
+        std::make_heap(events.begin(), events.end(), later);
+
+        return true;
+    }
+
+    return false;
+
+}
+
+void Core6502::Scheduler::clear() {
+    events.clear();
+}
+
+size_t Core6502::Scheduler::pending() const {
+    return events.size();
+}
+
+uint64_t Core6502::Scheduler::next() const {
+    return events.empty() ? UINT64_MAX : events[0].cycle;
+}
+
+void Core6502::Scheduler::fire(Core6502::CPU & cpu) {
+
+    // Off the heap before the call, which may schedule more
+    while (!events.empty() && events[0].cycle <= cpu.totalCycles) {
+        std::pop_heap(events.begin(), events.end(), later);
+        Event event = events.back();
+        events.pop_back();
+
+        fired++;
+        event.callback(cpu, event.cycle, event.context);
+    }
+
+}
+
+// run()/runUntil() with a scheduler attached.  Each slice ends on the next event's cycle, or
+// just past it when an instruction overshoots, and due events fire between slices.
+uint32_t Core6502::CPU::runScheduled(uint32_t cycles, int32_t stopPC, bool (*predicate)(Core6502::CPU&)) {
+
+    uint32_t elapsed = 0;
+
+    scheduler->dispatch(*this);
+
+    while (elapsed < cycles) {
+
+        uint32_t slice = cycles - elapsed;
+        uint64_t due = scheduler->next() - totalCycles;
+        if (due < slice) slice = (uint32_t)due;
+
+        uint32_t used = runLoop(slice, stopPC, predicate);
+        elapsed += used;
+
+        scheduler->dispatch(*this);
+
+        // Reached stopPC or the predicate
+        if (used < slice) break;
+
+    }
+
+    return elapsed;
+
+}
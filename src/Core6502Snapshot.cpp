@@ -0,0 +1,233 @@
+//
+//  Core6502Snapshot.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include <string.h>
+#include "Core6502.hpp"
+#include "Core6502Snapshot.hpp"
+
+Core6502::Snapshot::~Snapshot() {
+
+    for (int i = 0; i < Chunks; i++) release(chunks[i]);
+
+}
+
+const uint8_t * Core6502::Snapshot::page(uint8_t page) const {
+    return chunks[page / ChunkPages]->pages[page % ChunkPages]->data;
+}
+
+Core6502::Snapshot::Page * Core6502::Snapshot::retain(Core6502::Snapshot::Page * page) {
+
+    if (page) page->references++;
+    return page;
+
+}
+
+Core6502::Snapshot::Chunk * Core6502::Snapshot::retain(Core6502::Snapshot::Chunk * chunk) {
+
+    if (chunk) chunk->references++;
+    return chunk;
+
+}
+
+void Core6502::Snapshot::release(Core6502::Snapshot::Page * page) {
+
+    if (page && --page->references == 0) delete page;
+
+}
+
+void Core6502::Snapshot::release(Core6502::Snapshot::Chunk * chunk) {
+
+    if (!chunk || --chunk->references) return;
+
+    for (int i = 0; i < ChunkPages; i++) release(chunk->pages[i]);
+    delete chunk;
+
+}
+
+Core6502::Snapshots::Snapshots(Core6502::CPU & cpu) : cpu(cpu) {
+
+    pagesCopied = 0;
+    mapGeneration = cpu.bus.mapGeneration;
+
+    for (int i = 0; i < 0x100; i++) clean[i] = NULL;
+    for (int i = 0; i < Snapshot::Chunks; i++) cleanChunks[i] = NULL;
+    untrappedCount = 0;
+
+    trap = cpu.bus.addWriteTrap(written, this);
+    if (trap >= 0) for (int i = 0; i < 0x100; i++) cpu.bus.trapPage(trap, i);
+
+}
+
+Core6502::Snapshots::~Snapshots() {
+
+    if (trap >= 0) cpu.bus.removeWriteTrap(trap);
+    invalidate();
+
+}
+
+bool Core6502::Snapshots::tracking() const {
+    return trap >= 0;
+}
+
+void Core6502::Snapshots::invalidate() {
+
+    for (int i = 0; i < 0x100; i++) markDirty(i);
+
+}
+
+void Core6502::Snapshots::markDirty(uint8_t page) {
+
+    Snapshot::release(clean[page]);
+    clean[page] = NULL;
+
+    Snapshot::release(cleanChunks[page / Snapshot::ChunkPages]);
+    cleanChunks[page / Snapshot::ChunkPages] = NULL;
+
+}
+
+void Core6502::Snapshots::retrap() {
+
+    // Every page is clean again
+    for (int i = 0; i < untrappedCount; i++) cpu.bus.trapPage(trap, untrapped[i]);
+    untrappedCount = 0;
+
+}
+
+void Core6502::Snapshots::sync() {
+
+    // Untrapped pages may have been remapped onto clean memory, so nothing can be trusted
+    if (trap < 0 || cpu.bus.mapGeneration != mapGeneration) {
+        invalidate();
+        mapGeneration = cpu.bus.mapGeneration;
+
+        if (trap >= 0) for (int i = 0; i < 0x100; i++) cpu.bus.trapPage(trap, i);
+        untrappedCount = 0;
+    }
+
+}
+
+Core6502::Snapshot * Core6502::Snapshots::take() {
+
+    sync();
+
+    Snapshot * snapshot = new Snapshot();
+
+    snapshot->registers.PC = cpu.registers.PC;
+    snapshot->registers.SP = cpu.registers.SP;
+    snapshot->registers.A = cpu.registers.A;
+    snapshot->registers.X = cpu.registers.X;
+    snapshot->registers.Y = cpu.registers.Y;
+    snapshot->status = cpu.status.raw;
+    snapshot->cyclesRemaining = cpu.cyclesRemaining;
+    snapshot->totalCycles = cpu.totalCycles;
+
+    for (int c = 0; c < Snapshot::Chunks; c++) {
+
+        // Rebuild chunks with dirty pages, copying only those pages
+        if (!cleanChunks[c]) {
+            Snapshot::Chunk * chunk = new Snapshot::Chunk;
+            chunk->references = 1;
+
+            for (int i = 0; i < Snapshot::ChunkPages; i++) {
+                int page = c * Snapshot::ChunkPages + i;
+
+                if (!clean[page]) {
+                    clean[page] = new Snapshot::Page;
+                    clean[page]->references = 1;
+                    memcpy(clean[page]->data, cpu.mem + (page << 8), 0x100);
+                    pagesCopied++;
+                }
+
+                chunk->pages[i] = Snapshot::retain(clean[page]);
+            }
+
+            cleanChunks[c] = chunk;
+        }
+
+        snapshot->chunks[c] = Snapshot::retain(cleanChunks[c]);
+
+    }
+
+    retrap();
+
+    return snapshot;
+
+}
+
+void Core6502::Snapshots::restore(const Core6502::Snapshot & snapshot) {
+
+    sync();
+
+    // Copy back pages that differ from the snapshot, skipping chunks that match whole
+    bool copied[0x100];
+    int count = 0;
+
+    for (int c = 0; c < Snapshot::Chunks; c++) {
+        bool differs = cleanChunks[c] != snapshot.chunks[c];
+
+        for (int i = 0; i < Snapshot::ChunkPages; i++) {
+            int page = c * Snapshot::ChunkPages + i;
+            Snapshot::Page * saved = snapshot.chunks[c]->pages[i];
+
+            copied[page] = differs && clean[page] != saved;
+            if (!copied[page]) continue;
+
+            memcpy(cpu.mem + (page << 8), saved->data, 0x100);
+            pagesCopied++;
+            count++;
+        }
+    }
+
+    // Tell code caches on every bus page mapping restored memory.  Our own trap hears it too.
+    for (int page = 0; count && page < 0x100; page++) {
+        const uint8_t * data = cpu.bus.mapped(page);
+        if (data >= cpu.mem && data < cpu.mem + 0x10000 && copied[(data - cpu.mem) >> 8])
+            cpu.bus.invalidatePage(page);
+    }
+
+    // Memory matches the snapshot now
+    for (int c = 0; c < Snapshot::Chunks; c++) {
+        if (cleanChunks[c] == snapshot.chunks[c]) continue;
+
+        for (int i = 0; i < Snapshot::ChunkPages; i++) {
+            int page = c * Snapshot::ChunkPages + i;
+            Snapshot::release(clean[page]);
+            clean[page] = Snapshot::retain(snapshot.chunks[c]->pages[i]);
+        }
+
+        Snapshot::release(cleanChunks[c]);
+        cleanChunks[c] = Snapshot::retain(snapshot.chunks[c]);
+    }
+
+    cpu.registers.PC = snapshot.registers.PC;
+    cpu.registers.SP = snapshot.registers.SP;
+    cpu.registers.A = snapshot.registers.A;
+    cpu.registers.X = snapshot.registers.X;
+    cpu.registers.Y = snapshot.registers.Y;
+    cpu.status.raw = snapshot.status;
+    cpu.cyclesRemaining = snapshot.cyclesRemaining;
+    cpu.totalCycles = snapshot.totalCycles;
+
+    retrap();
+
+}
+
+void Core6502::Snapshots::written(void * context, uint16_t addr, uint8_t value) {
+
+    Core6502::Snapshots & snapshots = *(Core6502::Snapshots *)context;
+    Core6502::CPU & cpu = snapshots.cpu;
+    uint8_t page = addr >> 8;
+
+    // The write lands on whichever page of mem the bus page maps.  Pages mapped elsewhere
+    // (ROM, I/O, other buffers) can stop reporting until the next snapshot.
+    const uint8_t * data = cpu.bus.mapped(page);
+    if (data >= cpu.mem && data < cpu.mem + 0x10000) snapshots.markDirty((data - cpu.mem) >> 8);
+
+    cpu.bus.untrapPage(snapshots.trap, page);
+    snapshots.untrapped[snapshots.untrappedCount++] = page;
+
+}
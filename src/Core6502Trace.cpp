@@ -0,0 +1,228 @@
+//
+//  Core6502Trace.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include "Core6502Trace.hpp"
+
+static_assert(sizeof(Core6502::Trace::Record) == 16, "Trace records are 16 bytes");
+
+static const char magic[4] = {'C', '6', 'T', 'R'};
+static const uint8_t version = 1;
+static const int recordSize = 16;
+
+// Addressing modes, for laying out operands
+enum Mode { Mode_IMP, Mode_IMM, Mode_ACC, Mode_ZPG, Mode_ZPX, Mode_ZPY, Mode_ABS,
+            Mode_ABX, Mode_ABY, Mode_IZX, Mode_IZY, Mode_IND, Mode_REL };
+
+static const uint8_t modes[0x100] = {
+#define CORE6502_OPCODE(opCode, cycles, operation, addressing) Mode_##addressing,
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+};
+
+static const uint8_t lengths[0x100] = {
+#define CORE6502_OPCODE(opCode, cycles, operation, addressing) CORE6502_ADDRESSING_LENGTH_##addressing,
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+};
+
+static const char * const mnemonics[0x100] = {
+#define CORE6502_OPCODE(opCode, cycles, operation, addressing) #operation,
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+};
+
+static void putLE(std::ostream & out, uint64_t value, int bytes) {
+
+    uint8_t data[8];
+    for (int i = 0; i < bytes; i++) data[i] = (uint8_t)(value >> (i * 8));
+    out.write((const char *)data, bytes);
+
+}
+
+static uint64_t getLE(const uint8_t * data, int bytes) {
+
+    uint64_t value = 0;
+    for (int i = 0; i < bytes; i++) value |= (uint64_t)data[i] << (i * 8);
+    return value;
+
+}
+
+Core6502::Trace::Trace(size_t capacity) : head(0) {
+
+    // One slot more than kept, for the writer to fill while copy() reads the rest
+    size_t size = 2;
+    while (size < capacity + 1) size <<= 1;
+
+    records = new Record[size];
+    memset(records, 0, size * sizeof(Record));
+    mask = size - 1;
+    base = 0;
+    lastCycle = 0;
+
+}
+
+Core6502::Trace::~Trace() {
+    delete[] records;
+}
+
+size_t Core6502::Trace::capacity() const {
+    return mask;
+}
+
+uint64_t Core6502::Trace::count() const {
+    return head.load(std::memory_order_acquire);
+}
+
+void Core6502::Trace::clear() {
+    head.store(0, std::memory_order_release);
+    lastCycle = 0;
+}
+
+size_t Core6502::Trace::copy(Record * out, size_t max) const {
+
+    uint64_t end = head.load(std::memory_order_acquire);
+    uint64_t length = end < capacity() ? end : capacity();
+    if (length > max) length = max;
+    uint64_t start = end - length;
+
+    for (uint64_t i = start; i < end; i++) out[i - start] = records[i & mask];
+
+    // The writer may have lapped the copy.  While it writes record n, the slot of record
+    // n - slots is torn, so only records after that one are good.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t now = head.load(std::memory_order_relaxed);
+    uint64_t valid = now + 1 > mask + 1 ? now - mask : 0;
+
+    if (valid >= end) return 0;
+    if (valid > start) {
+        memmove(out, out + (valid - start), (end - valid) * sizeof(Record));
+        start = valid;
+    }
+
+    return (size_t)(end - start);
+
+}
+
+bool Core6502::Trace::write(std::ostream & out) const {
+
+    std::vector<Record> buffer(capacity());
+    size_t length = copy(buffer.data(), buffer.size());
+
+    out.write(magic, sizeof(magic));
+    putLE(out, version, 1);
+    putLE(out, 0, 3);
+    putLE(out, length, 4);
+    putLE(out, lastCycle, 8);
+
+    for (size_t i = 0; i < length; i++) {
+        const Record & record = buffer[i];
+        uint8_t data[recordSize] = {
+            (uint8_t)record.cycle, (uint8_t)(record.cycle >> 8),
+            (uint8_t)(record.cycle >> 16), (uint8_t)(record.cycle >> 24),
+            (uint8_t)record.PC, (uint8_t)(record.PC >> 8),
+            record.opCode, record.operands[0], record.operands[1],
+            record.A, record.X, record.Y, record.SP, record.P, 0, 0
+        };
+        out.write((const char *)data, recordSize);
+    }
+
+    return (bool)out;
+
+}
+
+bool Core6502::Trace::read(std::istream & in, std::vector<Record> & records, std::vector<uint64_t> & cycles) {
+
+    uint8_t header[20];
+    if (!in.read((char *)header, sizeof(header))) return false;
+    if (memcmp(header, magic, sizeof(magic)) != 0 || header[4] != version) return false;
+
+    uint32_t length = (uint32_t)getLE(header + 8, 4);
+    uint64_t lastCycle = getLE(header + 12, 8);
+
+    // The length is only trusted as far as the stream backs it up
+    records.clear();
+    cycles.clear();
+
+    for (uint32_t i = 0; i < length; i++) {
+        uint8_t data[recordSize];
+        if (!in.read((char *)data, recordSize)) return false;
+
+        Record record;
+        record.cycle = (uint32_t)getLE(data, 4);
+        record.PC = (uint16_t)getLE(data + 4, 2);
+        record.opCode = data[6];
+        record.operands[0] = data[7];
+        record.operands[1] = data[8];
+        record.A = data[9];
+        record.X = data[10];
+        record.Y = data[11];
+        record.SP = data[12];
+        record.P = data[13];
+        record.reserved[0] = record.reserved[1] = 0;
+        records.push_back(record);
+    }
+
+    cycles.resize(length);
+
+    // Records only keep the low 32 bits, work back from the newest record's full count
+    for (uint32_t i = length; i-- > 0;) {
+        cycles[i] = i + 1 == length ? lastCycle :
+            cycles[i + 1] - (uint32_t)(records[i + 1].cycle - records[i].cycle);
+    }
+
+    return true;
+
+}
+
+std::string Core6502::Trace::disassemble(const Record & record) {
+
+    uint8_t low = record.operands[0];
+    uint16_t word = low | (record.operands[1] << 8);
+    char operand[16] = "";
+
+    switch (modes[record.opCode]) {
+        case Mode_IMP: break;
+        case Mode_ACC: snprintf(operand, sizeof(operand), " A"); break;
+        case Mode_IMM: snprintf(operand, sizeof(operand), " #$%02X", low); break;
+        case Mode_ZPG: snprintf(operand, sizeof(operand), " $%02X", low); break;
+        case Mode_ZPX: snprintf(operand, sizeof(operand), " $%02X,X", low); break;
+        case Mode_ZPY: snprintf(operand, sizeof(operand), " $%02X,Y", low); break;
+        case Mode_ABS: snprintf(operand, sizeof(operand), " $%04X", word); break;
+        case Mode_ABX: snprintf(operand, sizeof(operand), " $%04X,X", word); break;
+        case Mode_ABY: snprintf(operand, sizeof(operand), " $%04X,Y", word); break;
+        case Mode_IZX: snprintf(operand, sizeof(operand), " ($%02X,X)", low); break;
+        case Mode_IZY: snprintf(operand, sizeof(operand), " ($%02X),Y", low); break;
+        case Mode_IND: snprintf(operand, sizeof(operand), " ($%04X)", word); break;
+        case Mode_REL:
+            snprintf(operand, sizeof(operand), " $%04X", (uint16_t)(record.PC + 2 + (int8_t)low));
+            break;
+    }
+
+    return std::string(mnemonics[record.opCode]) + operand;
+
+}
+
+std::string Core6502::Trace::format(const Record & record, uint64_t cycle) {
+
+    char bytes[9];
+    const uint8_t data[3] = {record.opCode, record.operands[0], record.operands[1]};
+    switch (lengths[record.opCode]) {
+        case 1: snprintf(bytes, sizeof(bytes), "%02X", data[0]); break;
+        case 2: snprintf(bytes, sizeof(bytes), "%02X %02X", data[0], data[1]); break;
+        default: snprintf(bytes, sizeof(bytes), "%02X %02X %02X", data[0], data[1], data[2]); break;
+    }
+
+    char line[96];
+    snprintf(line, sizeof(line), "%10llu  %04X  %-8s  %-14s A:%02X X:%02X Y:%02X SP:%02X P:%02X",
+             (unsigned long long)cycle, record.PC, bytes, disassemble(record).c_str(),
+             record.A, record.X, record.Y, record.SP, record.P);
+
+    return line;
+
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include "Core6502.hpp"
+#include "Core6502ALU.hpp"
+#include "Core6502OperationTemplates.hpp"
+
+class Core6502Tests_ALU : public testing::Test
+{
+public:
+    uint8_t mem[0x10000];
+	Core6502::CPU *cpu;
+
+	virtual void SetUp()
+	{
+        memset(mem, 0, sizeof(mem));
+        cpu = new Core6502::CPU(mem);
+	}
+
+	virtual void TearDown()
+	{
+        delete cpu;
+	}
+};
+
+// Status byte the long way, from signed and unsigned results
+static uint8_t referenceFlags(int result, bool carry, int signedResult) {
+    uint8_t flags = 0;
+    if (carry) flags |= 0x01;
+    if ((uint8_t)result == 0) flags |= 0x02;
+    if (signedResult < -128 || signedResult > 127) flags |= 0x20;
+    if (result & 0x80) flags |= 0x40;
+    return flags;
+}
+
+// Validates ADC and SBC for every carry, accumulator and operand
+TEST_F(Core6502Tests_ALU, Test_Arithmetic_Exhaustive) {
+
+    for (int carry = 0; carry < 2; carry++) {
+        for (int a = 0; a < 0x100; a++) {
+            for (int b = 0; b < 0x100; b++) {
+
+                int sum = a + b + carry;
+                uint16_t adc = Core6502::ALU::adc(a, b, carry);
+                ASSERT_EQ(adc & 0xFF, sum & 0xFF) << carry << " " << a << " " << b;
+                ASSERT_EQ(adc >> 8, referenceFlags(sum, sum > 0xFF, (int8_t)a + (int8_t)b + carry)) << carry << " " << a << " " << b;
+
+                // Carry in and out is the borrow
+                int difference = a - b - carry;
+                uint16_t sbc = Core6502::ALU::sbc(a, b, carry);
+                ASSERT_EQ(sbc & 0xFF, difference & 0xFF) << carry << " " << a << " " << b;
+                ASSERT_EQ(sbc >> 8, referenceFlags(difference, difference < 0, (int8_t)a - (int8_t)b - carry)) << carry << " " << a << " " << b;
+
+            }
+        }
+    }
+
+}
+
+// Validates CMP, CPX and CPY for every register and operand
+TEST_F(Core6502Tests_ALU, Test_Compare_Exhaustive) {
+
+    for (int reg = 0; reg < 0x100; reg++) {
+        for (int b = 0; b < 0x100; b++) {
+            ASSERT_EQ(Core6502::ALU::compare(reg, b), referenceFlags(reg - b, reg >= b, 0)) << reg << " " << b;
+        }
+    }
+
+}
+
+// Validates the templates apply every flag, and only those, in both flag modes
+TEST_F(Core6502Tests_ALU, Test_Templates) {
+
+    const uint8_t values[] = {0x00, 0x01, 0x3F, 0x40, 0x7F, 0x80, 0x81, 0xC0, 0xFE, 0xFF};
+    const int count = sizeof(values) / sizeof(values[0]);
+
+    for (int lazy = 0; lazy < 2; lazy++) {
+        for (int carry = 0; carry < 2; carry++) {
+            for (int i = 0; i < count; i++) {
+                for (int j = 0; j < count; j++) {
+
+                    uint8_t a = values[i], b = values[j];
+
+                    for (int op = 0; op < 4; op++) {
+
+                        // Every bit but D set outside the mask, so clobbering one shows
+                        uint8_t mask = op < 2 ? Core6502::ALU::ArithmeticFlags : Core6502::ALU::CompareFlags;
+                        uint8_t others = 0xF7 & ~mask;
+
+                        cpu->registers.PC = 0x4000;
+                        cpu->registers.A = cpu->registers.X = cpu->registers.Y = a;
+                        mem[0x4000] = b;
+                        cpu->status.raw = others | carry;
+
+                        uint8_t expected;
+                        if (op == 0) expected = Core6502::ALU::adc(a, b, carry) >> 8;
+                        else if (op == 1) expected = Core6502::ALU::sbc(a, b, carry) >> 8;
+                        else expected = Core6502::ALU::compare(a, b);
+
+                        if (lazy) {
+                            Core6502::Flags::Lazy::load(*cpu);
+                            if (op == 0) Core6502::ADC<Core6502::Addressing::Immediate, Core6502::Flags::Lazy>(*cpu);
+                            else if (op == 1) Core6502::SBC<Core6502::Addressing::Immediate, Core6502::Flags::Lazy>(*cpu);
+                            else if (op == 2) Core6502::CPX<Core6502::Addressing::Immediate, Core6502::Flags::Lazy>(*cpu);
+                            else Core6502::CPY<Core6502::Addressing::Immediate, Core6502::Flags::Lazy>(*cpu);
+                            Core6502::Flags::Lazy::store(*cpu);
+                        } else {
+                            if (op == 0) Core6502::ADC<Core6502::Addressing::Immediate>(*cpu);
+                            else if (op == 1) Core6502::SBC<Core6502::Addressing::Immediate>(*cpu);
+                            else if (op == 2) Core6502::CPX<Core6502::Addressing::Immediate>(*cpu);
+                            else Core6502::CPY<Core6502::Addressing::Immediate>(*cpu);
+                        }
+
+                        EXPECT_EQ(cpu->status.raw & mask, expected) << lazy << " " << op << " " << (int)a << " " << (int)b;
+                        EXPECT_EQ(cpu->status.raw & ~mask, others) << lazy << " " << op << " " << (int)a << " " << (int)b;
+
+                    }
+
+                }
+            }
+        }
+    }
+
+}
@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include <vector>
+#include "Core6502.hpp"
+#include "Core6502Batch.hpp"
+
+class Core6502Tests_Batch : public testing::Test
+{
+public:
+    // One full group plus a partial one
+    static const int Lanes = Core6502::Batch::Width + 8;
+
+    std::vector<uint8_t> batchMem[Lanes];
+    std::vector<uint8_t> tableMem[Lanes];
+	Core6502::CPU *batched[Lanes];
+	Core6502::CPU *table[Lanes];
+    Core6502::Batch *batch;
+    uint32_t seed;
+
+	virtual void SetUp()
+	{
+        seed = 0x6502;
+        batch = new Core6502::Batch();
+
+        // Create CPUs, each batched lane with a table core twin to check it against
+        for (int i = 0; i < Lanes; i++) {
+            batchMem[i].assign(0x10000, 0);
+            tableMem[i].assign(0x10000, 0);
+            batched[i] = new Core6502::CPU(&batchMem[i][0], Core6502::Interpreter::Switch);
+            table[i] = new Core6502::CPU(&tableMem[i][0], Core6502::Interpreter::Table);
+            EXPECT_EQ(batch->add(*batched[i]), (size_t)i);
+        }
+	}
+
+	virtual void TearDown()
+	{
+        delete batch;
+
+        for (int i = 0; i < Lanes; i++) {
+            delete batched[i];
+            delete table[i];
+        }
+	}
+
+    uint8_t random()
+    {
+        // xorshift32
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return (uint8_t)seed;
+    }
+
+    // Loads program at 0x8000 on every lane and its twin and resets them
+    void load(const uint8_t * program, size_t length)
+    {
+        for (int i = 0; i < Lanes; i++) {
+            memcpy(&batchMem[i][0x8000], program, length);
+            batchMem[i][0xFFFC] = 0x00;
+            batchMem[i][0xFFFD] = 0x80;
+            tableMem[i] = batchMem[i];
+
+            batched[i]->reset();
+            table[i]->reset();
+        }
+    }
+
+    // Runs the batch and every twin for cycles and compares them
+    void run(uint32_t cycles)
+    {
+        batch->run(cycles);
+
+        for (int i = 0; i < Lanes; i++) {
+            table[i]->run(cycles);
+
+            EXPECT_EQ(batched[i]->registers.PC, table[i]->registers.PC) << "lane " << i;
+            EXPECT_EQ(batched[i]->registers.SP, table[i]->registers.SP) << "lane " << i;
+            EXPECT_EQ(batched[i]->registers.A, table[i]->registers.A) << "lane " << i;
+            EXPECT_EQ(batched[i]->registers.X, table[i]->registers.X) << "lane " << i;
+            EXPECT_EQ(batched[i]->registers.Y, table[i]->registers.Y) << "lane " << i;
+            EXPECT_EQ(batched[i]->status.raw, table[i]->status.raw) << "lane " << i;
+            EXPECT_EQ(batched[i]->cyclesRemaining, table[i]->cyclesRemaining) << "lane " << i;
+            EXPECT_EQ(batched[i]->totalCycles, table[i]->totalCycles) << "lane " << i;
+            EXPECT_TRUE(batchMem[i] == tableMem[i]) << "lane " << i;
+        }
+    }
+};
+
+// Validates lanes running one program on different data match separate CPUs and share kernels
+TEST_F(Core6502Tests_Batch, Test_Same_Program_Different_Data) {
+
+    const uint8_t program[] = {
+        0xA5, 0x40,         // LDA $40
+        0xA6, 0x41,         // LDX $41
+        0x18,               // CLC
+        0x65, 0x40,         // ADC $40
+        0x9D, 0x00, 0x02,   // STA $0200,X
+        0x49, 0x5A,         // EOR #$5A
+        0xC9, 0x80,         // CMP #$80
+        0xB0, 0x02,         // BCS $8012
+        0xE8,               // INX
+        0xE8,               // INX
+        0xCA,               // DEX
+        0x86, 0x41,         // STX $41
+        0xD0, 0xF0,         // BNE $8007
+        0xE6, 0x42,         // INC $42
+        0x2A,               // ROL A
+        0x0A,               // ASL A
+        0x4A,               // LSR A
+        0x6A,               // ROR A
+        0xC6, 0x43,         // DEC $43
+        0x8E, 0x44, 0x00,   // STX $0044
+        0x4C, 0x00, 0x80    // JMP $8000
+    };
+
+    load(program, sizeof(program));
+
+    for (int i = 0; i < Lanes; i++) {
+        batchMem[i][0x40] = tableMem[i][0x40] = (uint8_t)(i * 11);
+        batchMem[i][0x41] = tableMem[i][0x41] = (uint8_t)(i + 1);
+    }
+
+    // Odd budgets so instructions straddle calls
+    for (int i = 0; i < 50; i++) run(37);
+
+    EXPECT_GT(batch->lockstepInstructions, 0u);
+
+}
+
+// Validates lanes agree with separate CPUs once they diverge on random code and data
+TEST_F(Core6502Tests_Batch, Test_Random_Programs) {
+
+    for (int i = 0; i < Lanes; i++) {
+        for (size_t j = 0; j < batchMem[i].size(); j++) batchMem[i][j] = random();
+        tableMem[i] = batchMem[i];
+
+        table[i]->registers.PC = 0x4000;
+        table[i]->registers.SP = random();
+        table[i]->registers.A = random();
+        table[i]->registers.X = random();
+        table[i]->registers.Y = random();
+        table[i]->status.raw = random();
+
+        batched[i]->registers = table[i]->registers;
+        batched[i]->status = table[i]->status;
+    }
+
+    for (int i = 0; i < 20; i++) run(101);
+
+    EXPECT_GT(batch->scalarInstructions, 0u);
+
+}
+
+// Validates lanes still finishing an earlier instruction skip the call like CPU::run does
+TEST_F(Core6502Tests_Batch, Test_Drains_Partial_Instructions) {
+
+    const uint8_t program[] = {
+        0xE8,               // INX
+        0x4C, 0x00, 0x80    // JMP $8000
+    };
+
+    load(program, sizeof(program));
+
+    for (int i = 0; i < Lanes; i++) batched[i]->cyclesRemaining = table[i]->cyclesRemaining = i % 4;
+
+    run(2);
+    run(5);
+
+}
+
+// NOP; NOP; NOP; JMP $9000, served by a device that counts reads
+static const uint8_t deviceCode[] = {0xEA, 0xEA, 0xEA, 0x4C, 0x00, 0x90};
+
+static uint8_t countingCode(void * context, uint16_t addr) {
+    (*(uint32_t *)context)++;
+    return deviceCode[(addr & 0xFF) % sizeof(deviceCode)];
+}
+
+// Validates opcodes on I/O pages are read once per instruction, diverged or waiting
+TEST_F(Core6502Tests_Batch, Test_Reads_IO_Opcodes_Once) {
+
+    const uint8_t program[] = {
+        0xE8,               // INX
+        0x4C, 0x00, 0x80    // JMP $8000
+    };
+
+    load(program, sizeof(program));
+
+    // Lane 0 runs from the device while the rest stay at $8000
+    uint32_t batchReads = 0, tableReads = 0;
+    batched[0]->bus.mapIO(0x9000, 0x100, countingCode, NULL, &batchReads);
+    table[0]->bus.mapIO(0x9000, 0x100, countingCode, NULL, &tableReads);
+    batched[0]->registers.PC = table[0]->registers.PC = 0x9000;
+
+    run(100);
+    run(37);
+
+    EXPECT_GT(tableReads, 50u);
+    EXPECT_EQ(batchReads, tableReads);
+    EXPECT_GT(batch->scalarInstructions, 0u);
+
+}
@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include <vector>
+#include "Core6502.hpp"
+
+class Core6502Tests_BlockCache : public testing::Test
+{
+public:
+    std::vector<uint8_t> tableMem;
+    std::vector<uint8_t> cachedMem;
+	Core6502::CPU *table;
+	Core6502::CPU *cached;
+    uint32_t seed;
+
+	virtual void SetUp()
+	{
+        tableMem.assign(0x10000, 0);
+        cachedMem.assign(0x10000, 0);
+        seed = 0x6502;
+
+        // Create CPUs
+        table = new Core6502::CPU(&tableMem[0], Core6502::Interpreter::Table);
+        cached = new Core6502::CPU(&cachedMem[0], Core6502::Interpreter::Cached);
+	}
+
+	virtual void TearDown()
+	{
+        delete table;
+        delete cached;
+	}
+
+    uint8_t random()
+    {
+        // xorshift32
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return (uint8_t)seed;
+    }
+
+    // Loads the same program at 0x8000 into both CPUs and resets them
+    void load(const uint8_t * program, size_t length)
+    {
+        memcpy(&tableMem[0x8000], program, length);
+        tableMem[0xFFFC] = 0x00;
+        tableMem[0xFFFD] = 0x80;
+        cachedMem = tableMem;
+
+        table->reset();
+        cached->reset();
+    }
+
+    void expectSameState()
+    {
+        EXPECT_EQ(table->registers.PC, cached->registers.PC);
+        EXPECT_EQ(table->registers.SP, cached->registers.SP);
+        EXPECT_EQ(table->registers.A, cached->registers.A);
+        EXPECT_EQ(table->registers.X, cached->registers.X);
+        EXPECT_EQ(table->registers.Y, cached->registers.Y);
+        EXPECT_EQ(table->status.raw, cached->status.raw);
+        EXPECT_EQ(table->cyclesRemaining, cached->cyclesRemaining);
+        EXPECT_EQ(table->totalCycles, cached->totalCycles);
+        EXPECT_TRUE(tableMem == cachedMem);
+    }
+};
+
+// n_sum example program, N = 10
+static const uint8_t nSum[] = {
+    0xA9, 0x00, 0xA2, 0x0A, 0x86, 0x40, 0x65, 0x40, 0xCA,
+    0xD0, 0x04, 0xEA, 0x4C, 0x0B, 0x80, 0x4C, 0x04, 0x80
+};
+
+TEST_F(Core6502Tests_BlockCache, Test_NSum_Matches_Table)
+{
+    load(nSum, sizeof(nSum));
+
+    table->runUntil(0x800B, 10000);
+    cached->runUntil(0x800B, 10000);
+
+    expectSameState();
+    EXPECT_EQ(cached->registers.A, 55);
+    EXPECT_GT(cached->blockCache->hits, 0);
+}
+
+TEST_F(Core6502Tests_BlockCache, Test_Run_Matches_Clock_At_Every_Length)
+{
+    load(nSum, sizeof(nSum));
+
+    // Budgets that end mid-block must stop at the same instruction as the table core
+    for (uint32_t cycles = 1; cycles < 40; cycles++) {
+        table->run(cycles);
+        cached->run(cycles);
+        expectSameState();
+    }
+}
+
+TEST_F(Core6502Tests_BlockCache, Test_Stops_Inside_Block)
+{
+    load(nSum, sizeof(nSum));
+
+    // 0x8008 (DEX) sits in the middle of the loop block
+    table->runUntil(0x8008, 10000);
+    cached->runUntil(0x8008, 10000);
+    expectSameState();
+
+    table->runUntil(0x8008, 10000);
+    cached->runUntil(0x8008, 10000);
+    expectSameState();
+}
+
+static uint32_t predicateCalls;
+
+static bool fortiethCall(Core6502::CPU & cpu) {
+    return ++predicateCalls == 40;
+}
+
+// Validates a predicate that stops a block midway isn't asked again at the same boundary
+TEST_F(Core6502Tests_BlockCache, Test_Predicate_Asked_Once_Per_Boundary)
+{
+    load(nSum, sizeof(nSum));
+
+    predicateCalls = 0;
+    table->runUntil(fortiethCall, 10000);
+    EXPECT_EQ(predicateCalls, 40u);
+
+    predicateCalls = 0;
+    cached->runUntil(fortiethCall, 10000);
+    EXPECT_EQ(predicateCalls, 40u);
+
+    expectSameState();
+}
+
+TEST_F(Core6502Tests_BlockCache, Test_Self_Modifying_Code)
+{
+    // Each pass rewrites the immediate of the following LDA inside the same block:
+    //  8000: LDX #$05
+    //  8002: TXA
+    //  8003: STA $8007
+    //  8006: LDA #$00      <- operand patched to X
+    //  8008: STA $0300,X
+    //  800B: DEX
+    //  800C: BNE $8002
+    //  800E: NOP
+    const uint8_t program[] = {
+        0xA2, 0x05, 0x8A, 0x8D, 0x07, 0x80, 0xA9, 0x00, 0x9D, 0x00, 0x03,
+        0xCA, 0xD0, 0xF4, 0xEA
+    };
+    load(program, sizeof(program));
+
+    table->runUntil(0x800E, 10000);
+    cached->runUntil(0x800E, 10000);
+
+    expectSameState();
+    for (int i = 1; i <= 5; i++) EXPECT_EQ(cachedMem[0x0300 + i], i);
+}
+
+TEST_F(Core6502Tests_BlockCache, Test_Remap_Flushes)
+{
+    // Two ROM banks at 0xC000 with different LDA immediates, JMP back to the start
+    uint8_t bankA[0x100] = {0xA9, 0x11, 0x4C, 0x00, 0xC0};
+    uint8_t bankB[0x100] = {0xA9, 0x22, 0x4C, 0x00, 0xC0};
+
+    cached->bus.mapROM(0xC000, sizeof(bankA), bankA);
+    cached->registers.PC = 0xC000;
+    cached->runUntil(0xC002, 100);
+    EXPECT_EQ(cached->registers.A, 0x11);
+
+    cached->bus.mapROM(0xC000, sizeof(bankB), bankB);
+    cached->registers.PC = 0xC000;
+    cached->runUntil(0xC002, 100);
+    EXPECT_EQ(cached->registers.A, 0x22);
+}
+
+TEST_F(Core6502Tests_BlockCache, Test_IO_Pages_Run_Uncached)
+{
+    load(nSum, sizeof(nSum));
+
+    // Code on an I/O page still runs, one instruction at a time
+    cached->bus.mapIO(0x8000, 0x100, NULL, NULL, NULL);
+    cached->run(10);
+
+    EXPECT_EQ(cached->blockCache->hits, 0);
+    EXPECT_EQ(cached->totalCycles, 10);
+}
+
+// Random code including branches, jumps and stores into the code itself
+TEST_F(Core6502Tests_BlockCache, Test_Random_Code_Matches_Table)
+{
+    for (int round = 0; round < 20; round++) {
+
+        for (size_t i = 0; i < tableMem.size(); i++) tableMem[i] = random();
+        cachedMem = tableMem;
+
+        table->registers.PC = 0x4000;
+        table->registers.SP = random();
+        table->registers.A = random();
+        table->registers.X = random();
+        table->registers.Y = random();
+        table->status.raw = random();
+        table->cyclesRemaining = 0;
+
+        cached->registers = table->registers;
+        cached->status = table->status;
+        cached->cyclesRemaining = 0;
+        cached->blockCache->flush();
+
+        for (int i = 0; i < 50; i++) {
+            uint32_t cycles = 1 + random();
+            table->run(cycles);
+            cached->run(cycles);
+        }
+
+        expectSameState();
+    }
+}
@@ -0,0 +1,246 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include "Core6502.hpp"
+
+class Core6502Tests_Bus : public testing::Test
+{
+public:
+    uint8_t mem[0x10000];
+    Core6502::CPU *cpu;
+
+    // Trap the removing traps take off the bus
+    int victim;
+
+    static void removeVictim(void * context, uint16_t addr, uint8_t value)
+    {
+        Core6502Tests_Bus * self = (Core6502Tests_Bus *)context;
+        self->cpu->bus.removeWriteTrap(self->victim);
+    }
+
+    static void removeReadVictim(void * context, uint16_t addr, uint8_t value)
+    {
+        Core6502Tests_Bus * self = (Core6502Tests_Bus *)context;
+        self->cpu->bus.removeReadTrap(self->victim);
+    }
+
+    // I/O capture
+    uint16_t lastWriteAddr;
+    uint8_t lastWriteValue;
+    uint32_t ioReads;
+
+    static uint8_t ioRead(void * context, uint16_t addr)
+    {
+        Core6502Tests_Bus * self = (Core6502Tests_Bus *)context;
+        self->ioReads++;
+        return (uint8_t)(addr ^ 0x5A);
+    }
+
+    static void ioWrite(void * context, uint16_t addr, uint8_t value)
+    {
+        Core6502Tests_Bus * self = (Core6502Tests_Bus *)context;
+        self->lastWriteAddr = addr;
+        self->lastWriteValue = value;
+    }
+
+	virtual void SetUp()
+	{
+        memset(mem, 0, sizeof(mem));
+        mem[0xFFFC] = 0x00;
+        mem[0xFFFD] = 0x80;
+
+        lastWriteAddr = 0;
+        lastWriteValue = 0;
+        ioReads = 0;
+
+        cpu = new Core6502::CPU(mem);
+        cpu->reset();
+	}
+
+	virtual void TearDown()
+	{
+        delete cpu;
+	}
+};
+
+TEST_F(Core6502Tests_Bus, Test_RAMDefault)
+{
+    cpu->write(0x1234, 0x42);
+
+    EXPECT_EQ(mem[0x1234], 0x42);
+    EXPECT_EQ(cpu->read(0x1234), 0x42);
+}
+
+TEST_F(Core6502Tests_Bus, Test_ROMIgnoresWrites)
+{
+    uint8_t rom[0x200];
+    memset(rom, 0xEA, sizeof(rom));
+
+    cpu->bus.mapROM(0xC000, sizeof(rom), rom);
+
+    // STA $C010
+    mem[0x8000] = 0xA9; mem[0x8001] = 0x11;
+    mem[0x8002] = 0x8D; mem[0x8003] = 0x10; mem[0x8004] = 0xC0;
+    cpu->step();
+    cpu->step();
+
+    EXPECT_EQ(rom[0x10], 0xEA);
+    EXPECT_EQ(cpu->read(0xC010), 0xEA);
+    EXPECT_EQ(cpu->read(0xC1FF), 0xEA);
+
+    // Pages outside the ROM still reach RAM
+    EXPECT_EQ(cpu->read(0xC200), 0x00);
+}
+
+TEST_F(Core6502Tests_Bus, Test_IOCallbacks)
+{
+    cpu->bus.mapIO(0xD000, 0x100, ioRead, ioWrite, this);
+
+    // LDA $D012, STA $D020
+    mem[0x8000] = 0xAD; mem[0x8001] = 0x12; mem[0x8002] = 0xD0;
+    mem[0x8003] = 0x8D; mem[0x8004] = 0x20; mem[0x8005] = 0xD0;
+    cpu->step();
+    cpu->step();
+
+    EXPECT_EQ(cpu->registers.A, (uint8_t)(0xD012 ^ 0x5A));
+    EXPECT_EQ(ioReads, 1);
+    EXPECT_EQ(lastWriteAddr, 0xD020);
+    EXPECT_EQ(lastWriteValue, (uint8_t)(0xD012 ^ 0x5A));
+
+    // RAM behind the I/O page is untouched
+    EXPECT_EQ(mem[0xD020], 0x00);
+}
+
+TEST_F(Core6502Tests_Bus, Test_Mirror)
+{
+    // Mirror the zero page and stack ($0000-$01FF) across $0000-$07FF
+    cpu->bus.mirror(0x0200, 0x600, 0x0000);
+
+    cpu->write(0x0010, 0x33);
+    cpu->write(0x0710, 0x44);
+
+    EXPECT_EQ(cpu->read(0x0210), 0x33);
+    EXPECT_EQ(cpu->read(0x0410), 0x33);
+    EXPECT_EQ(cpu->read(0x0110), 0x44);
+    EXPECT_EQ(cpu->read(0x0510), 0x44);
+    EXPECT_EQ(mem[0x0010], 0x33);
+    EXPECT_EQ(mem[0x0110], 0x44);
+}
+
+TEST_F(Core6502Tests_Bus, Test_Unmap)
+{
+    mem[0x6000] = 0x99;
+    cpu->bus.unmap(0x6000, 0x2000);
+
+    cpu->write(0x6001, 0x77);
+
+    EXPECT_EQ(cpu->read(0x6000), 0x00);
+    EXPECT_EQ(cpu->read(0x7FFF), 0x00);
+    EXPECT_EQ(mem[0x6001], 0x00);
+}
+
+TEST_F(Core6502Tests_Bus, Test_WriteTrap)
+{
+    int trap = cpu->bus.addWriteTrap(ioWrite, this);
+    ASSERT_GE(trap, 0);
+
+    cpu->bus.trapPage(trap, 0x20);
+    cpu->write(0x2010, 0x5A);
+
+    // Trap sees the write and the write still lands
+    EXPECT_EQ(lastWriteAddr, 0x2010);
+    EXPECT_EQ(lastWriteValue, 0x5A);
+    EXPECT_EQ(mem[0x2010], 0x5A);
+
+    // Remapping keeps the trap
+    cpu->bus.mapRAM(0x2000, 0x100, &mem[0x3000]);
+    cpu->write(0x2011, 0x6B);
+    EXPECT_EQ(lastWriteAddr, 0x2011);
+    EXPECT_EQ(mem[0x3011], 0x6B);
+
+    cpu->bus.removeWriteTrap(trap);
+    cpu->write(0x2012, 0x7C);
+    EXPECT_EQ(lastWriteAddr, 0x2011);
+    EXPECT_EQ(mem[0x3012], 0x7C);
+}
+
+TEST_F(Core6502Tests_Bus, Test_ReadTrap)
+{
+    int trap = cpu->bus.addReadTrap(ioWrite, this);
+    ASSERT_GE(trap, 0);
+
+    // Trapped pages leave the fast path but keep their memory
+    mem[0x2010] = 0x4D;
+    cpu->bus.trapPageReads(trap, 0x20);
+    EXPECT_EQ(cpu->bus.readPage[0x20], (uint8_t *)NULL);
+    EXPECT_EQ(cpu->bus.mapped(0x20), &mem[0x2000]);
+
+    // Trap sees the address and the value read
+    EXPECT_EQ(cpu->read(0x2010), 0x4D);
+    EXPECT_EQ(lastWriteAddr, 0x2010);
+    EXPECT_EQ(lastWriteValue, 0x4D);
+
+    // I/O reads reach the handler first
+    cpu->bus.mapIO(0x2000, 0x100, ioRead, ioWrite, this);
+    EXPECT_EQ(cpu->read(0x2020), 0x20 ^ 0x5A);
+    EXPECT_EQ(ioReads, 1u);
+    EXPECT_EQ(lastWriteAddr, 0x2020);
+
+    // Remapping keeps the trap until it's removed
+    cpu->bus.mapRAM(0x2000, 0x100, &mem[0x3000]);
+    EXPECT_EQ(cpu->bus.readPage[0x20], (uint8_t *)NULL);
+    cpu->bus.removeReadTrap(trap);
+    EXPECT_EQ(cpu->bus.readPage[0x20], &mem[0x3000]);
+}
+
+TEST_F(Core6502Tests_Bus, Test_InvalidatePage)
+{
+    int trap = cpu->bus.addWriteTrap(ioWrite, this);
+    ASSERT_GE(trap, 0);
+
+    cpu->bus.trapPage(trap, 0x20);
+    mem[0x2000] = 0x3C;
+
+    // Untrapped pages report nothing
+    cpu->bus.invalidatePage(0x21);
+    EXPECT_EQ(lastWriteAddr, 0x0000);
+
+    // Trap hears about the page with its current first byte
+    cpu->bus.invalidatePage(0x20);
+    EXPECT_EQ(lastWriteAddr, 0x2000);
+    EXPECT_EQ(lastWriteValue, 0x3C);
+
+    cpu->bus.removeWriteTrap(trap);
+}
+
+TEST_F(Core6502Tests_Bus, Test_TrapRemovesAnother)
+{
+    int remover = cpu->bus.addWriteTrap(removeVictim, this);
+    victim = cpu->bus.addWriteTrap(ioWrite, this);
+    ASSERT_LT(remover, victim);
+
+    // The victim is gone before its turn comes
+    cpu->bus.trapPage(remover, 0x20);
+    cpu->bus.trapPage(victim, 0x20);
+    cpu->write(0x2010, 0x5A);
+    EXPECT_EQ(lastWriteAddr, 0x0000);
+    EXPECT_EQ(mem[0x2010], 0x5A);
+
+    victim = cpu->bus.addWriteTrap(ioWrite, this);
+    cpu->bus.trapPage(victim, 0x20);
+    cpu->bus.invalidatePage(0x20);
+    EXPECT_EQ(lastWriteAddr, 0x0000);
+
+    cpu->bus.removeWriteTrap(remover);
+
+    // Same for read traps
+    remover = cpu->bus.addReadTrap(removeReadVictim, this);
+    victim = cpu->bus.addReadTrap(ioWrite, this);
+    ASSERT_LT(remover, victim);
+
+    cpu->bus.trapPageReads(remover, 0x20);
+    cpu->bus.trapPageReads(victim, 0x20);
+    EXPECT_EQ(cpu->read(0x2010), 0x5A);
+    EXPECT_EQ(lastWriteAddr, 0x0000);
+
+    cpu->bus.removeReadTrap(remover);
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include "Core6502.hpp"
+#include "Core6502Debugger.hpp"
+
+// Copies $0301 to $0300 three times, then spins at 0x800B
+static const uint8_t program[] = {
+    0xA2, 0x03,             // LDX #$03
+    0xAD, 0x01, 0x03,       // LDA $0301
+    0x8D, 0x00, 0x03,       // STA $0300
+    0xCA,                   // DEX
+    0xD0, 0xF7,             // BNE $8002
+    0x4C, 0x0B, 0x80        // JMP $800B
+};
+
+static const Core6502::Interpreter interpreters[] = {
+    Core6502::Interpreter::Table,
+    Core6502::Interpreter::Switch,
+    Core6502::Interpreter::Cached,
+#ifdef CORE6502_JIT
+    Core6502::Interpreter::JIT,
+#endif
+};
+
+class Core6502Tests_Debugger : public testing::Test
+{
+public:
+    uint8_t mem[0x10000];
+	Core6502::CPU *cpu;
+    Core6502::Debugger *debugger;
+
+	virtual void SetUp()
+	{
+        cpu = NULL;
+        debugger = NULL;
+	}
+
+	virtual void TearDown()
+	{
+        delete debugger;
+        delete cpu;
+	}
+
+    void load(Core6502::Interpreter interpreter)
+    {
+        delete debugger;
+        delete cpu;
+
+        memset(mem, 0, sizeof(mem));
+        memcpy(&mem[0x8000], program, sizeof(program));
+        mem[0x0301] = 0x42;
+        mem[0xFFFC] = 0x00;
+        mem[0xFFFD] = 0x80;
+
+        cpu = new Core6502::CPU(mem, interpreter);
+        cpu->reset();
+        debugger = new Core6502::Debugger(*cpu);
+        cpu->debugger = debugger;
+    }
+};
+
+// Validates breakpoints stop before their instruction on every core, and running again continues
+TEST_F(Core6502Tests_Debugger, Test_Breakpoint) {
+
+    for (Core6502::Interpreter interpreter : interpreters) {
+
+        load(interpreter);
+        debugger->addBreakpoint(0x8008);
+        EXPECT_TRUE(debugger->breakpoint(0x8008));
+        EXPECT_TRUE(debugger->armed());
+
+        for (int pass = 0; pass < 3; pass++) {
+            cpu->run(1000);
+            EXPECT_EQ(cpu->registers.PC, 0x8008) << (int)interpreter;
+            EXPECT_EQ(cpu->registers.X, 3 - pass) << (int)interpreter;
+            EXPECT_EQ(debugger->stopped, Core6502::Debugger::Stop::Breakpoint) << (int)interpreter;
+            EXPECT_EQ(debugger->address, 0x8008) << (int)interpreter;
+        }
+        EXPECT_EQ(debugger->hits, 3u);
+
+        // Out of the loop for good
+        debugger->removeBreakpoint(0x8008);
+        EXPECT_FALSE(debugger->armed());
+        cpu->run(1000);
+        EXPECT_EQ(cpu->registers.PC, 0x800B) << (int)interpreter;
+        EXPECT_EQ(debugger->stopped, Core6502::Debugger::Stop::None) << (int)interpreter;
+
+    }
+
+}
+
+// Validates watchpoints stop after the instruction making the access on every core
+TEST_F(Core6502Tests_Debugger, Test_Watchpoint) {
+
+    for (Core6502::Interpreter interpreter : interpreters) {
+
+        load(interpreter);
+        ASSERT_TRUE(debugger->addWatchpoint(0x0301, Core6502::Debugger::Read));
+        ASSERT_TRUE(debugger->addWatchpoint(0x0300, Core6502::Debugger::Write));
+        EXPECT_EQ(debugger->watchpoint(0x0300), Core6502::Debugger::Write);
+
+        cpu->runUntil(0x800B, 1000);
+        EXPECT_EQ(cpu->registers.PC, 0x8005) << (int)interpreter;
+        EXPECT_EQ(cpu->registers.A, 0x42) << (int)interpreter;
+        EXPECT_EQ(debugger->stopped, Core6502::Debugger::Stop::Watchpoint) << (int)interpreter;
+        EXPECT_EQ(debugger->address, 0x0301) << (int)interpreter;
+        EXPECT_EQ(debugger->access, Core6502::Debugger::Read) << (int)interpreter;
+
+        cpu->runUntil(0x800B, 1000);
+        EXPECT_EQ(cpu->registers.PC, 0x8008) << (int)interpreter;
+        EXPECT_EQ(mem[0x0300], 0x42) << (int)interpreter;
+        EXPECT_EQ(debugger->address, 0x0300) << (int)interpreter;
+        EXPECT_EQ(debugger->access, Core6502::Debugger::Write) << (int)interpreter;
+
+        // Unwatched addresses on the same page don't stop
+        debugger->removeWatchpoint(0x0301, Core6502::Debugger::Read);
+        debugger->removeWatchpoint(0x0300, Core6502::Debugger::Write);
+        cpu->runUntil(0x800B, 1000);
+        EXPECT_EQ(cpu->registers.PC, 0x800B) << (int)interpreter;
+        EXPECT_EQ(debugger->stopped, Core6502::Debugger::Stop::None) << (int)interpreter;
+
+    }
+
+}
+
+// Validates pages go back on the fast path once nothing on them is watched
+TEST_F(Core6502Tests_Debugger, Test_Pages) {
+
+    load(Core6502::Interpreter::Table);
+
+    debugger->addWatchpoint(0x0300, Core6502::Debugger::Read | Core6502::Debugger::Write);
+    debugger->addWatchpoint(0x0301, Core6502::Debugger::Read);
+    EXPECT_EQ(cpu->bus.readPage[0x03], (uint8_t *)NULL);
+    EXPECT_EQ(cpu->bus.writePage[0x03], (uint8_t *)NULL);
+    EXPECT_EQ(cpu->bus.readPage[0x04], &mem[0x0400]);
+
+    debugger->removeWatchpoint(0x0300, Core6502::Debugger::Read | Core6502::Debugger::Write);
+    EXPECT_EQ(cpu->bus.readPage[0x03], (uint8_t *)NULL);
+    EXPECT_EQ(cpu->bus.writePage[0x03], &mem[0x0300]);
+
+    debugger->addBreakpoint(0x8000);
+    debugger->clear();
+    EXPECT_FALSE(debugger->armed());
+    EXPECT_EQ(cpu->bus.readPage[0x03], &mem[0x0300]);
+
+}
+
+static bool pastLoad(Core6502::CPU & cpu) {
+    return cpu.registers.PC == 0x8005;
+}
+
+// Validates the caller's predicate and stop PC still work with breakpoints armed
+TEST_F(Core6502Tests_Debugger, Test_With_Predicate) {
+
+    load(Core6502::Interpreter::Switch);
+    debugger->addBreakpoint(0x8009);
+
+    cpu->runUntil(pastLoad, 1000);
+    EXPECT_EQ(cpu->registers.PC, 0x8005);
+    EXPECT_EQ(debugger->stopped, Core6502::Debugger::Stop::None);
+
+    cpu->runUntil(0x8008, 1000);
+    EXPECT_EQ(cpu->registers.PC, 0x8008);
+    EXPECT_EQ(debugger->stopped, Core6502::Debugger::Stop::None);
+
+    cpu->runUntil(0x800B, 1000);
+    EXPECT_EQ(cpu->registers.PC, 0x8009);
+    EXPECT_EQ(debugger->stopped, Core6502::Debugger::Stop::Breakpoint);
+
+}
@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include "Core6502.hpp"
+#include "Core6502OperationTemplates.hpp"
+
+class Core6502Tests_Decimal : public testing::Test
+{
+public:
+    uint8_t mem[0x10000];
+	Core6502::CPU *cpu;
+
+	virtual void SetUp()
+	{
+        memset(mem, 0, sizeof(mem));
+        cpu = new Core6502::CPU(mem);
+	}
+
+	virtual void TearDown()
+	{
+        delete cpu;
+	}
+
+    // Runs ADC or SBC #b from a, with carry, through the template in FlagMode
+    template <class FlagMode>
+    void arithmetic(bool subtract, bool decimal, uint8_t carry, uint8_t a, uint8_t b)
+    {
+        cpu->registers.PC = 0x4000;
+        cpu->registers.A = a;
+        mem[0x4000] = b;
+        cpu->status.raw = 0;
+        cpu->status.bitfield.DecimalMode = decimal;
+        cpu->status.bitfield.CarryFlag = carry;
+
+        FlagMode::load(*cpu);
+        if (subtract) Core6502::SBC<Core6502::Addressing::Immediate, FlagMode>(*cpu);
+        else Core6502::ADC<Core6502::Addressing::Immediate, FlagMode>(*cpu);
+        FlagMode::store(*cpu);
+    }
+};
+
+struct Expected {
+    uint8_t A;
+    bool C, Z, V, N;
+};
+
+// NMOS decimal ADC, written out digit by digit from "Decimal Mode" by Bruce Clark, appendix A
+static Expected referenceADC(uint8_t carry, uint8_t a, uint8_t b)
+{
+    int aLow = a & 0x0F, aHigh = a >> 4;
+    int bLow = b & 0x0F, bHigh = b >> 4;
+
+    int low = aLow + bLow + carry;
+    bool halfCarry = low > 9;
+    if (halfCarry) low = (low + 6) & 0x0F;
+
+    int high = aHigh + bHigh + halfCarry;
+
+    // N and V look at the high digit before it is adjusted
+    int8_t signedHigh = (int8_t)(high * 16);
+    int signedSum = (int8_t)(a & 0xF0) + (int8_t)(b & 0xF0) + (halfCarry ? 0x10 : 0);
+
+    if (high > 9) high += 6;
+
+    Expected expected;
+    expected.A = (uint8_t)(high * 16 + low);
+    expected.C = high > 15;
+    expected.Z = (uint8_t)(a + b + carry) == 0;
+    expected.V = signedSum < -128 || signedSum > 127;
+    expected.N = signedHigh < 0;
+    return expected;
+}
+
+// NMOS decimal SBC result.  Carry is the borrow, as in the binary SBC here.
+static uint8_t referenceSBC(uint8_t borrow, uint8_t a, uint8_t b)
+{
+    int low = (a & 0x0F) - (b & 0x0F) - borrow;
+    bool halfBorrow = low < 0;
+    if (halfBorrow) low = (low - 6) & 0x0F;
+
+    int high = (a >> 4) - (b >> 4) - halfBorrow;
+    if (high < 0) high -= 6;
+
+    return (uint8_t)(high * 16 + low);
+}
+
+// Validates a few sums worked by hand, including invalid digits and NMOS flag quirks
+TEST_F(Core6502Tests_Decimal, Test_ADC_Examples) {
+
+    struct Case { uint8_t carry, a, b, result; bool C, Z, V, N; };
+    const Case cases[] = {
+        {0, 0x12, 0x34, 0x46, 0, 0, 0, 0},
+        {1, 0x58, 0x46, 0x05, 1, 0, 1, 1},
+        {0, 0x81, 0x92, 0x73, 1, 0, 1, 0},
+        {0, 0x99, 0x01, 0x00, 1, 0, 0, 1},  // Z from the binary sum, N from before the high digit is adjusted
+        {0, 0x50, 0x50, 0x00, 1, 0, 1, 1},
+        {0, 0x0F, 0x01, 0x16, 0, 0, 0, 0},  // Invalid low digit
+        {1, 0x99, 0x66, 0x66, 1, 1, 0, 0},  // Binary sum is 0x100
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const Case & c = cases[i];
+        arithmetic<Core6502::Flags::Status>(false, true, c.carry, c.a, c.b);
+
+        EXPECT_EQ(cpu->registers.A, c.result) << "case " << i;
+        EXPECT_EQ(cpu->status.bitfield.CarryFlag, c.C) << "case " << i;
+        EXPECT_EQ(cpu->status.bitfield.ZeroFlag, c.Z) << "case " << i;
+        EXPECT_EQ(cpu->status.bitfield.OverflowFlag, c.V) << "case " << i;
+        EXPECT_EQ(cpu->status.bitfield.NegativeFlag, c.N) << "case " << i;
+    }
+
+}
+
+TEST_F(Core6502Tests_Decimal, Test_SBC_Examples) {
+
+    struct Case { uint8_t borrow, a, b, result; };
+    const Case cases[] = {
+        {0, 0x46, 0x12, 0x34},
+        {0, 0x40, 0x13, 0x27},
+        {1, 0x32, 0x02, 0x29},
+        {0, 0x12, 0x21, 0x91},
+        {1, 0x00, 0x00, 0x99},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const Case & c = cases[i];
+        arithmetic<Core6502::Flags::Status>(true, true, c.borrow, c.a, c.b);
+        EXPECT_EQ(cpu->registers.A, c.result) << "case " << i;
+    }
+
+}
+
+// Validates every carry, accumulator and operand in both flag modes
+TEST_F(Core6502Tests_Decimal, Test_ADC_Exhaustive) {
+
+    for (int carry = 0; carry < 2; carry++) {
+        for (int a = 0; a < 0x100; a++) {
+            for (int b = 0; b < 0x100; b++) {
+
+                Expected expected = referenceADC(carry, a, b);
+
+                for (int lazy = 0; lazy < 2; lazy++) {
+                    if (lazy) arithmetic<Core6502::Flags::Lazy>(false, true, carry, a, b);
+                    else arithmetic<Core6502::Flags::Status>(false, true, carry, a, b);
+
+                    ASSERT_EQ(cpu->registers.A, expected.A) << carry << " " << a << " " << b;
+                    ASSERT_EQ(cpu->status.bitfield.CarryFlag, expected.C) << carry << " " << a << " " << b;
+                    ASSERT_EQ(cpu->status.bitfield.ZeroFlag, expected.Z) << carry << " " << a << " " << b;
+                    ASSERT_EQ(cpu->status.bitfield.OverflowFlag, expected.V) << carry << " " << a << " " << b;
+                    ASSERT_EQ(cpu->status.bitfield.NegativeFlag, expected.N) << carry << " " << a << " " << b;
+                }
+
+            }
+        }
+    }
+
+}
+
+// Validates every borrow, accumulator and operand, with flags the same as binary mode
+TEST_F(Core6502Tests_Decimal, Test_SBC_Exhaustive) {
+
+    for (int borrow = 0; borrow < 2; borrow++) {
+        for (int a = 0; a < 0x100; a++) {
+            for (int b = 0; b < 0x100; b++) {
+
+                arithmetic<Core6502::Flags::Status>(true, false, borrow, a, b);
+                uint8_t binaryFlags = cpu->status.raw & ~0x08;
+
+                for (int lazy = 0; lazy < 2; lazy++) {
+                    if (lazy) arithmetic<Core6502::Flags::Lazy>(true, true, borrow, a, b);
+                    else arithmetic<Core6502::Flags::Status>(true, true, borrow, a, b);
+
+                    ASSERT_EQ(cpu->registers.A, referenceSBC(borrow, a, b)) << borrow << " " << a << " " << b;
+                    ASSERT_EQ(cpu->status.raw & ~0x08, binaryFlags) << borrow << " " << a << " " << b;
+                }
+
+            }
+        }
+    }
+
+}
+
+static const Core6502::Interpreter interpreters[] = {
+    Core6502::Interpreter::Table,
+    Core6502::Interpreter::Switch,
+    Core6502::Interpreter::Cached,
+#ifdef CORE6502_JIT
+    Core6502::Interpreter::JIT,
+#endif
+};
+
+// Validates every core switches in and out of decimal mode through SED, CLD and PLP
+TEST_F(Core6502Tests_Decimal, Test_Cores) {
+
+    const uint8_t program[] = {
+        0xF8,               // SED
+        0x18,               // CLC
+        0xA9, 0x19,         // LDA #$19
+        0x69, 0x01,         // ADC #$01
+        0x85, 0x10,         // STA $10
+        0xD8,               // CLD
+        0x69, 0x01,         // ADC #$01
+        0x85, 0x11,         // STA $11
+        0xA9, 0x08,         // LDA #$08
+        0x48,               // PHA
+        0x28,               // PLP
+        0xA9, 0x09,         // LDA #$09
+        0x69, 0x01,         // ADC #$01
+        0x85, 0x12,         // STA $12
+        0x38,               // SEC
+        0xA9, 0x10,         // LDA #$10
+        0xE9, 0x01,         // SBC #$01
+        0x85, 0x13,         // STA $13
+        0xD8,               // CLD
+        0x4C, 0x00, 0x90    // JMP $9000
+    };
+
+    for (Core6502::Interpreter interpreter : interpreters) {
+
+        uint8_t coreMem[0x10000];
+        memset(coreMem, 0, sizeof(coreMem));
+        memcpy(&coreMem[0x8000], program, sizeof(program));
+        coreMem[0xFFFC] = 0x00;
+        coreMem[0xFFFD] = 0x80;
+
+        Core6502::CPU * core = new Core6502::CPU(coreMem, interpreter);
+        core->reset();
+        core->runUntil(0x9000, 1000);
+
+        EXPECT_EQ(core->registers.PC, 0x9000) << (int)interpreter;
+        EXPECT_EQ(coreMem[0x10], 0x20) << (int)interpreter;
+        EXPECT_EQ(coreMem[0x11], 0x21) << (int)interpreter;
+        EXPECT_EQ(coreMem[0x12], 0x10) << (int)interpreter;
+        EXPECT_EQ(coreMem[0x13], 0x08) << (int)interpreter;
+        EXPECT_EQ(core->status.bitfield.DecimalMode, 0) << (int)interpreter;
+
+        delete core;
+
+    }
+
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include "Core6502.hpp"
+#include "Core6502Flags.hpp"
+
+class Core6502Tests_Flags : public testing::Test
+{
+public:
+    uint8_t mem[0x10000];
+	Core6502::CPU *cpu;
+    
+	virtual void SetUp()
+	{  
+        memset(mem, 0, sizeof(mem));
+
+        // Create CPU on the switch core, which runs with lazy flags when they're built in
+        cpu = new Core6502::CPU(&mem[0], Core6502::Interpreter::Switch);
+	}
+
+	virtual void TearDown()
+	{
+        delete cpu;
+	}
+
+    // Loads program at 0x8000 and resets
+    void load(const uint8_t * program, size_t length)
+    {
+        memcpy(&mem[0x8000], program, length);
+        mem[0xFFFC] = 0x00;
+        mem[0xFFFD] = 0x80;
+        cpu->reset();
+    }
+};
+
+// Validates lazy flags unpack and rebuild every status value unchanged
+TEST_F(Core6502Tests_Flags, Test_Load_Store_Round_Trip) {
+
+    for (int raw = 0; raw < 0x100; raw++) {
+        cpu->status.raw = raw;
+        Core6502::Flags::Lazy::load(*cpu);
+        cpu->status.raw = ~raw;
+        Core6502::Flags::Lazy::store(*cpu);
+
+        // Flags outside N/Z/C/V are left as they were
+        EXPECT_EQ(cpu->status.raw & 0x63, raw & 0x63);
+        EXPECT_EQ(cpu->status.raw & 0x9C, ~raw & 0x9C);
+    }
+
+}
+
+// Validates lazy and eager flag modes agree on each setter
+TEST_F(Core6502Tests_Flags, Test_Lazy_Matches_Status) {
+
+    Core6502::CPU eager(&mem[0]);
+
+    for (int result = 0; result < 0x100; result++) {
+        cpu->status.raw = eager.status.raw = 0;
+        Core6502::Flags::Lazy::load(*cpu);
+
+        Core6502::Flags::Lazy::setNZ(*cpu, result);
+        Core6502::Flags::Status::setNZ(eager, result);
+        Core6502::Flags::Lazy::setCarry(*cpu, result & 1);
+        Core6502::Flags::Status::setCarry(eager, result & 1);
+        Core6502::Flags::Lazy::setOverflow(*cpu, result & 2);
+        Core6502::Flags::Status::setOverflow(eager, result & 2);
+
+        EXPECT_EQ(Core6502::Flags::Lazy::raw(*cpu), Core6502::Flags::Status::raw(eager));
+        EXPECT_EQ(Core6502::Flags::Lazy::negative(*cpu), Core6502::Flags::Status::negative(eager));
+        EXPECT_EQ(Core6502::Flags::Lazy::zero(*cpu), Core6502::Flags::Status::zero(eager));
+    }
+
+}
+
+// Validates PHP inside a run pushes flags set by earlier instructions
+TEST_F(Core6502Tests_Flags, Test_PHP_Sees_Pending_Flags) {
+
+    const uint8_t program[] = {
+        0xA9, 0x80,     // LDA #$80
+        0x38,           // SEC
+        0x08,           // PHP
+        0xA9, 0x00,     // LDA #$00
+        0x08,           // PHP
+    };
+    load(program, sizeof(program));
+    cpu->registers.SP = 0xFF;
+
+    cpu->runUntil(0x8007, 100);
+
+    EXPECT_EQ(mem[0x1FF], 0x45);    // N, I, C
+    EXPECT_EQ(mem[0x1FE], 0x07);    // Z, I, C
+
+}
+
+// Validates status written by the host between runs is what the next run starts from
+TEST_F(Core6502Tests_Flags, Test_Host_Status_Write_Is_Seen) {
+
+    const uint8_t program[] = {
+        0xA9, 0x01,     // LDA #$01
+        0x69, 0x01,     // ADC #$01
+        0xF0, 0xFE,     // BEQ *
+    };
+    load(program, sizeof(program));
+
+    cpu->runUntil(0x8002, 100);
+    cpu->status.bitfield.CarryFlag = 1;
+    cpu->runUntil(0x8004, 100);
+
+    EXPECT_EQ(cpu->registers.A, 0x03);
+    EXPECT_FALSE(cpu->status.bitfield.ZeroFlag);
+
+    // Host forces Z, so the BEQ spins in place
+    cpu->status.bitfield.ZeroFlag = 1;
+    cpu->step();
+
+    EXPECT_EQ(cpu->registers.PC, 0x8004);
+
+}
+
+static bool stopOnZero(Core6502::CPU & cpu) {
+    return cpu.status.bitfield.ZeroFlag;
+}
+
+// Validates predicates see flags from the instruction just executed
+TEST_F(Core6502Tests_Flags, Test_Predicate_Sees_Pending_Flags) {
+
+    const uint8_t program[] = {
+        0xA2, 0x03,     // LDX #$03
+        0xCA,           // DEX
+        0xD0, 0xFD,     // BNE $8002
+        0xEA,           // NOP
+    };
+    load(program, sizeof(program));
+    cpu->status.bitfield.ZeroFlag = 0;
+
+    cpu->runUntil(stopOnZero, 100);
+
+    EXPECT_EQ(cpu->registers.X, 0x00);
+    EXPECT_EQ(cpu->registers.PC, 0x8003);
+
+}
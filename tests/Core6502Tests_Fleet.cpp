@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include <vector>
+#include "Core6502.hpp"
+#include "Core6502Fleet.hpp"
+
+class Core6502Tests_Fleet : public testing::Test
+{
+public:
+    static const int Instances = 24;
+
+    std::vector<uint8_t> fleetMem[Instances];
+    std::vector<uint8_t> soloMem[Instances];
+	Core6502::CPU *fleet[Instances];
+	Core6502::CPU *solo[Instances];
+    int finished[Instances];
+
+	virtual void SetUp()
+	{
+        // Summing loop, each instance starting from its own count
+        const uint8_t program[] = {
+            0xA6, 0x40,         // LDX $40
+            0x18,               // CLC
+            0x65, 0x41,         // ADC $41
+            0x85, 0x41,         // STA $41
+            0xCA,               // DEX
+            0xD0, 0xF8,         // BNE $8002
+            0xE6, 0x42,         // INC $42
+            0x4C, 0x00, 0x80    // JMP $8000
+        };
+
+        // Create CPUs, each fleet instance with a twin run on this thread
+        for (int i = 0; i < Instances; i++) {
+            fleetMem[i].assign(0x10000, 0);
+            memcpy(&fleetMem[i][0x8000], program, sizeof(program));
+            fleetMem[i][0x40] = (uint8_t)(i * 9 + 1);
+            fleetMem[i][0xFFFC] = 0x00;
+            fleetMem[i][0xFFFD] = 0x80;
+            soloMem[i] = fleetMem[i];
+
+            fleet[i] = new Core6502::CPU(&fleetMem[i][0], Core6502::Interpreter::Switch);
+            solo[i] = new Core6502::CPU(&soloMem[i][0], Core6502::Interpreter::Switch);
+            fleet[i]->reset();
+            solo[i]->reset();
+
+            finished[i] = 0;
+        }
+	}
+
+	virtual void TearDown()
+	{
+        for (int i = 0; i < Instances; i++) {
+            delete fleet[i];
+            delete solo[i];
+        }
+	}
+
+    static void done(void * context, Core6502::CPU &)
+    {
+        (*(int *)context)++;
+    }
+
+    void expectMatch(int i)
+    {
+        EXPECT_EQ(fleet[i]->registers.PC, solo[i]->registers.PC) << "instance " << i;
+        EXPECT_EQ(fleet[i]->registers.A, solo[i]->registers.A) << "instance " << i;
+        EXPECT_EQ(fleet[i]->registers.X, solo[i]->registers.X) << "instance " << i;
+        EXPECT_EQ(fleet[i]->status.raw, solo[i]->status.raw) << "instance " << i;
+        // Quanta can end partway through an instruction, so count what's still owed
+        EXPECT_EQ(fleet[i]->totalCycles + fleet[i]->cyclesRemaining,
+                  solo[i]->totalCycles + solo[i]->cyclesRemaining) << "instance " << i;
+        EXPECT_TRUE(fleetMem[i] == soloMem[i]) << "instance " << i;
+    }
+};
+
+// Validates instances run on several threads end up as if each ran alone
+TEST_F(Core6502Tests_Fleet, Test_Matches_Single_Thread) {
+
+    Core6502::Fleet runner;
+    runner.quantum = 997;
+
+    // Budgets that differ per instance, so some finish early and the rest get stolen
+    for (int i = 0; i < Instances; i++) {
+        uint64_t cycles = 5000 + i * 1733;
+        EXPECT_EQ(runner.add(*fleet[i], cycles, done, &finished[i]), (size_t)i);
+
+        for (uint64_t ran = 0; ran < cycles; ran += 997)
+            solo[i]->run(cycles - ran < 997 ? (uint32_t)(cycles - ran) : 997);
+    }
+
+    runner.run(4);
+
+    uint64_t total = 0;
+    for (int i = 0; i < Instances; i++) {
+        EXPECT_EQ(finished[i], 1);
+        expectMatch(i);
+        total += 5000 + i * 1733;
+    }
+
+    uint64_t ran = 0;
+    ASSERT_EQ(runner.workerCycles.size(), 4u);
+    for (size_t i = 0; i < runner.workerCycles.size(); i++) ran += runner.workerCycles[i];
+    EXPECT_EQ(ran, total);
+
+}
+
+// Validates instances with a stop address finish when they reach it
+TEST_F(Core6502Tests_Fleet, Test_Stop_PC) {
+
+    Core6502::Fleet runner;
+    runner.quantum = 50;
+
+    for (int i = 0; i < Instances; i++) {
+        runner.add(*fleet[i], 1000000, done, &finished[i], 0x800A);
+        solo[i]->runUntil(0x800A, 1000000);
+    }
+
+    runner.run(3);
+
+    for (int i = 0; i < Instances; i++) {
+        EXPECT_EQ(finished[i], 1);
+        EXPECT_EQ(fleet[i]->registers.PC, 0x800A);
+        expectMatch(i);
+    }
+
+}
@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include <vector>
+#include "Core6502.hpp"
+
+class Core6502Tests_IdleLoop : public testing::Test
+{
+public:
+    uint8_t memA[0x10000];
+    uint8_t memB[0x10000];
+	Core6502::CPU *naive;
+	Core6502::CPU *skipping;
+
+	virtual void SetUp()
+	{
+        naive = NULL;
+        skipping = NULL;
+	}
+
+	virtual void TearDown()
+	{
+        delete naive;
+        delete skipping;
+	}
+
+    // Two CPUs on the same program at 0x8000, one with skipping off
+    void load(const std::vector<uint8_t> & program, Core6502::Interpreter interpreter = CORE6502_DEFAULT_INTERPRETER)
+    {
+        delete naive;
+        delete skipping;
+
+        memset(memA, 0, sizeof(memA));
+        memcpy(&memA[0x8000], &program[0], program.size());
+        memA[0xFFFC] = 0x00;
+        memA[0xFFFD] = 0x80;
+        memcpy(memB, memA, sizeof(memA));
+
+        naive = new Core6502::CPU(memA, interpreter);
+        skipping = new Core6502::CPU(memB, interpreter);
+        naive->idleSkipping = false;
+        naive->reset();
+        skipping->reset();
+    }
+
+    void expectSameState()
+    {
+        EXPECT_EQ(naive->registers.PC, skipping->registers.PC);
+        EXPECT_EQ(naive->registers.A, skipping->registers.A);
+        EXPECT_EQ(naive->registers.X, skipping->registers.X);
+        EXPECT_EQ(naive->registers.Y, skipping->registers.Y);
+        EXPECT_EQ(naive->registers.SP, skipping->registers.SP);
+        EXPECT_EQ(naive->status.raw, skipping->status.raw);
+        EXPECT_EQ(naive->cyclesRemaining, skipping->cyclesRemaining);
+        EXPECT_EQ(naive->totalCycles, skipping->totalCycles);
+    }
+
+    // Runs both CPUs through budgets that end on and between passes of the loop
+    void runBoth()
+    {
+        const uint32_t budgets[] = {1, 7, 100, 1001, 3, 65536, 12345, 2};
+        for (size_t i = 0; i < sizeof(budgets) / sizeof(budgets[0]); i++) {
+            EXPECT_EQ(naive->run(budgets[i]), skipping->run(budgets[i]));
+            expectSameState();
+        }
+    }
+};
+
+static const Core6502::Interpreter interpreters[] = {
+    Core6502::Interpreter::Table,
+    Core6502::Interpreter::Switch,
+    Core6502::Interpreter::Cached,
+#ifdef CORE6502_JIT
+    Core6502::Interpreter::JIT,
+#endif
+};
+
+// Validates JMP * is skipped with the same cycles and state as running it
+TEST_F(Core6502Tests_IdleLoop, Test_SelfJump) {
+
+    for (Core6502::Interpreter interpreter : interpreters) {
+        load({0xA9, 0x42, 0x4C, 0x02, 0x80}, interpreter);      // LDA #$42; JMP *
+        runBoth();
+        EXPECT_GT(skipping->idleCyclesSkipped, 70000u);
+        EXPECT_EQ(naive->idleCyclesSkipped, 0u);
+    }
+
+}
+
+// Validates the NOP; JMP loop the n_sum example ends in
+TEST_F(Core6502Tests_IdleLoop, Test_NSumSpin) {
+
+    for (Core6502::Interpreter interpreter : interpreters) {
+        load({0xA9, 0x00, 0xA2, 0x0A, 0x86, 0x40, 0x65, 0x40, 0xCA,
+              0xD0, 0x04, 0xEA, 0x4C, 0x0B, 0x80, 0x4C, 0x04, 0x80}, interpreter);
+        runBoth();
+        EXPECT_EQ(skipping->registers.A, 55);
+        EXPECT_GT(skipping->idleCyclesSkipped, 70000u);
+    }
+
+}
+
+// Validates a branch to itself that's always taken
+TEST_F(Core6502Tests_IdleLoop, Test_BranchToSelf) {
+
+    for (Core6502::Interpreter interpreter : interpreters) {
+        load({0xA2, 0x01, 0xD0, 0xFE}, interpreter);            // LDX #1; BNE *
+        runBoth();
+        EXPECT_GT(skipping->idleCyclesSkipped, 70000u);
+    }
+
+}
+
+// Validates polling RAM skips until the flag changes, then carries on like running would
+TEST_F(Core6502Tests_IdleLoop, Test_PollRAM) {
+
+    for (Core6502::Interpreter interpreter : interpreters) {
+        // Wait for $10 to be set, then INX; JMP back to waiting
+        load({0xA5, 0x10, 0xF0, 0xFC, 0xE8, 0xA9, 0x00, 0x85, 0x10, 0x4C, 0x00, 0x80}, interpreter);
+        runBoth();
+        EXPECT_GT(skipping->idleCyclesSkipped, 70000u);
+
+        memA[0x10] = memB[0x10] = 1;
+        runBoth();
+        EXPECT_EQ(skipping->registers.X, 1);
+        EXPECT_EQ(memB[0x10], 0);
+    }
+
+}
+
+// Validates loops that change registers or read I/O run as usual
+static int ioReads = 0;
+static uint8_t countingRead(void *, uint16_t) { ioReads++; return 0; }
+
+TEST_F(Core6502Tests_IdleLoop, Test_NotIdle) {
+
+    for (Core6502::Interpreter interpreter : interpreters) {
+        load({0xE8, 0x4C, 0x00, 0x80}, interpreter);            // INX; JMP $8000
+        runBoth();
+        EXPECT_EQ(skipping->idleCyclesSkipped, 0u);
+
+        load({0xAD, 0x00, 0xD0, 0xF0, 0xFB}, interpreter);      // LDA $D000; BEQ -5
+        naive->bus.mapIO(0xD000, 0x100, countingRead, NULL, NULL);
+        skipping->bus.mapIO(0xD000, 0x100, countingRead, NULL, NULL);
+        ioReads = 0;
+        naive->run(1000);
+        int naiveReads = ioReads;
+        ioReads = 0;
+        skipping->run(1000);
+        EXPECT_EQ(ioReads, naiveReads);
+        EXPECT_EQ(skipping->idleCyclesSkipped, 0u);
+        expectSameState();
+
+        load({0x8D, 0x00, 0x02, 0x4C, 0x00, 0x80}, interpreter);    // STA $0200; JMP $8000
+        runBoth();
+        EXPECT_EQ(skipping->idleCyclesSkipped, 0u);
+
+        load({0xA2, 0x05, 0x9A, 0x4C, 0x02, 0x80}, interpreter);    // LDX #5; TXS; JMP $8002
+        runBoth();
+        EXPECT_EQ(skipping->idleCyclesSkipped, 0u);
+        EXPECT_EQ(memB[0x01FF], 0x05);
+    }
+
+}
+
+// Validates runUntil() still stops on a PC inside the loop and counts cycles the same
+TEST_F(Core6502Tests_IdleLoop, Test_RunUntil) {
+
+    for (Core6502::Interpreter interpreter : interpreters) {
+        load({0xEA, 0xEA, 0x4C, 0x00, 0x80}, interpreter);      // NOP; NOP; JMP $8000
+        EXPECT_EQ(naive->runUntil(0x9000, 50000), skipping->runUntil(0x9000, 50000));
+        expectSameState();
+        EXPECT_GT(skipping->idleCyclesSkipped, 40000u);
+
+        EXPECT_EQ(naive->runUntil(0x8001, 50000), skipping->runUntil(0x8001, 50000));
+        expectSameState();
+        EXPECT_EQ(skipping->registers.PC, 0x8001);
+    }
+
+}
+
+// Validates an overridden opcode in the loop turns skipping off
+static int nopCalls = 0;
+static void countingNOP(Core6502::CPU &, Core6502::Instruction &) { nopCalls++; }
+
+TEST_F(Core6502Tests_IdleLoop, Test_OverriddenOpcode) {
+
+    load({0xEA, 0x4C, 0x00, 0x80}, Core6502::Interpreter::Table);
+    skipping->instructions[0xEA].instructionFunction = countingNOP;
+
+    nopCalls = 0;
+    skipping->run(5000);
+    EXPECT_EQ(nopCalls, 1000);
+    EXPECT_EQ(skipping->idleCyclesSkipped, 0u);
+
+}
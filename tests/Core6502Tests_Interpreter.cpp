@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include <vector>
+#include "Core6502.hpp"
+#include "Core6502OperationTemplates.hpp"
+
+class Core6502Tests_Interpreter : public testing::Test
+{
+public:
+    std::vector<uint8_t> tableMem;
+    std::vector<uint8_t> switchMem;
+	Core6502::CPU *table;
+	Core6502::CPU *switched;
+    uint32_t seed;
+    
+	virtual void SetUp()
+	{  
+        tableMem.resize(0x10000);
+        switchMem.resize(0x10000);
+        seed = 0x6502;
+
+        // Create CPUs
+        table = new Core6502::CPU(&tableMem[0], Core6502::Interpreter::Table);
+        switched = new Core6502::CPU(&switchMem[0], Core6502::Interpreter::Switch);
+	}
+
+	virtual void TearDown()
+	{
+        delete table;
+        delete switched;
+	}
+
+    uint8_t random()
+    {
+        // xorshift32
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return (uint8_t)seed;
+    }
+
+    // Fills memory and registers with the same random values on both CPUs
+    void randomize()
+    {
+        for (size_t i = 0; i < tableMem.size(); i++) tableMem[i] = random();
+        switchMem = tableMem;
+
+        table->registers.PC = 0x4000;
+        table->registers.SP = random();
+        table->registers.A = random();
+        table->registers.X = random();
+        table->registers.Y = random();
+        table->status.raw = random();
+        table->cyclesRemaining = 0;
+
+        switched->registers = table->registers;
+        switched->status = table->status;
+        switched->cyclesRemaining = 0;
+    }
+
+    void expectSameState()
+    {
+        EXPECT_EQ(table->registers.PC, switched->registers.PC);
+        EXPECT_EQ(table->registers.SP, switched->registers.SP);
+        EXPECT_EQ(table->registers.A, switched->registers.A);
+        EXPECT_EQ(table->registers.X, switched->registers.X);
+        EXPECT_EQ(table->registers.Y, switched->registers.Y);
+        EXPECT_EQ(table->status.raw, switched->status.raw);
+        EXPECT_EQ(table->cyclesRemaining, switched->cyclesRemaining);
+        EXPECT_EQ(table->totalCycles, switched->totalCycles);
+        EXPECT_TRUE(tableMem == switchMem);
+    }
+};
+
+// Validates every opcode leaves the switch core in the same state as the table core
+TEST_F(Core6502Tests_Interpreter, Test_Every_Opcode_Matches_Table) {
+
+    for (int opCode = 0; opCode < 0x100; opCode++) {
+        for (int i = 0; i < 4; i++) {
+
+            randomize();
+            tableMem[0x4000] = switchMem[0x4000] = opCode;
+
+            EXPECT_EQ(table->step(), switched->step()) << "opcode " << opCode;
+            expectSameState();
+
+        }
+    }
+
+}
+
+// Validates run loops agree over a longer random program
+TEST_F(Core6502Tests_Interpreter, Test_Run_Matches_Table) {
+
+    randomize();
+
+    for (uint32_t budget = 1; budget < 200; budget += 7) {
+        EXPECT_EQ(table->run(budget), switched->run(budget));
+        expectSameState();
+    }
+
+    EXPECT_EQ(table->runUntil(0x4000, 500), switched->runUntil(0x4000, 500));
+    expectSameState();
+
+}
+
+// Validates clock() in the switch core
+TEST_F(Core6502Tests_Interpreter, Test_Clock_Matches_Table) {
+
+    randomize();
+
+    for (int i = 0; i < 100; i++) {
+        table->clock();
+        switched->clock();
+        expectSameState();
+    }
+
+}
+
+static void loadFortyTwo(Core6502::CPU &cpu, Core6502::Instruction &op) {
+    cpu.registers.A = 42;
+}
+
+// Validates overrides are honored by the table core only
+TEST_F(Core6502Tests_Interpreter, Test_Override) {
+
+    randomize();
+    tableMem[0x4000] = switchMem[0x4000] = 0x02;
+
+    Core6502::Instruction op = {0x02, 2, loadFortyTwo};
+    table->instructions[0x02] = op;
+    switched->instructions[0x02] = op;
+
+    uint8_t a = switched->registers.A;
+    table->step();
+    switched->step();
+
+    EXPECT_EQ(table->registers.A, 42);
+    EXPECT_EQ(switched->registers.A, a);
+
+}
+
+// Validates the specialized per-opcode functions match the pointer based operations
+TEST_F(Core6502Tests_Interpreter, Test_Specialized_Operations) {
+
+    for (int opCode = 0; opCode < 0x100; opCode++) {
+
+        randomize();
+        tableMem[0x4000] = switchMem[0x4000] = opCode;
+
+        table->step();
+
+        switched->registers.PC++;
+        Core6502::specializedOperations[opCode](*switched);
+        switched->totalCycles += switched->instructions[opCode].cycles + switched->extraCycles;
+        switched->extraCycles = 0;
+
+        expectSameState();
+
+    }
+
+}
+
+// Validates calling a template with an explicit addressing mode
+TEST_F(Core6502Tests_Interpreter, Test_Template_Addressing) {
+
+    randomize();
+
+    // LDA $CAFE,X
+    switched->registers.PC = 0x4000;
+    switched->registers.X = 0x10;
+    switchMem[0x4000] = 0xFE;
+    switchMem[0x4001] = 0xCA;
+    switchMem[0xCB0E] = 0x80;
+
+    Core6502::LDA<Core6502::Addressing::AbsoluteX>(*switched);
+
+    EXPECT_EQ(switched->registers.A, 0x80);
+    EXPECT_EQ(switched->registers.PC, 0x4002);
+    EXPECT_EQ(switched->status.bitfield.NegativeFlag, 1);
+    EXPECT_EQ(switched->status.bitfield.ZeroFlag, 0);
+
+}
@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include <vector>
+#include "Core6502.hpp"
+
+// Only built into Core6502TestsJIT, against the Core6502JIT library
+
+class Core6502Tests_JIT : public testing::Test
+{
+public:
+    std::vector<uint8_t> tableMem;
+    std::vector<uint8_t> jitMem;
+	Core6502::CPU *table;
+	Core6502::CPU *jit;
+    uint32_t seed;
+
+	virtual void SetUp()
+	{
+        tableMem.assign(0x10000, 0);
+        jitMem.assign(0x10000, 0);
+        seed = 0x6502;
+
+        // Create CPUs
+        table = new Core6502::CPU(&tableMem[0], Core6502::Interpreter::Table);
+        jit = new Core6502::CPU(&jitMem[0], Core6502::Interpreter::JIT);
+	}
+
+	virtual void TearDown()
+	{
+        delete table;
+        delete jit;
+	}
+
+    uint8_t random()
+    {
+        // xorshift32
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return (uint8_t)seed;
+    }
+
+    // Fills memory and registers with the same random values on both CPUs
+    void randomize()
+    {
+        for (size_t i = 0; i < tableMem.size(); i++) tableMem[i] = random();
+        jitMem = tableMem;
+
+        table->registers.PC = 0x4000;
+        table->registers.SP = random();
+        table->registers.A = random();
+        table->registers.X = random();
+        table->registers.Y = random();
+        table->status.raw = random();
+        table->cyclesRemaining = 0;
+
+        jit->registers = table->registers;
+        jit->status = table->status;
+        jit->cyclesRemaining = 0;
+        jit->jit->flush();
+    }
+
+    // Loads the same program at 0x8000 into both CPUs and resets them
+    void load(const uint8_t * program, size_t length)
+    {
+        memcpy(&tableMem[0x8000], program, length);
+        tableMem[0xFFFC] = 0x00;
+        tableMem[0xFFFD] = 0x80;
+        jitMem = tableMem;
+
+        table->reset();
+        jit->reset();
+    }
+
+    void expectSameState()
+    {
+        EXPECT_EQ(table->registers.PC, jit->registers.PC);
+        EXPECT_EQ(table->registers.SP, jit->registers.SP);
+        EXPECT_EQ(table->registers.A, jit->registers.A);
+        EXPECT_EQ(table->registers.X, jit->registers.X);
+        EXPECT_EQ(table->registers.Y, jit->registers.Y);
+        EXPECT_EQ(table->status.raw, jit->status.raw);
+        EXPECT_EQ(table->cyclesRemaining, jit->cyclesRemaining);
+        EXPECT_EQ(table->totalCycles, jit->totalCycles);
+        EXPECT_TRUE(tableMem == jitMem);
+    }
+};
+
+// n_sum example program, N = 10
+static const uint8_t nSum[] = {
+    0xA9, 0x00, 0xA2, 0x0A, 0x86, 0x40, 0x65, 0x40, 0xCA,
+    0xD0, 0x04, 0xEA, 0x4C, 0x0B, 0x80, 0x4C, 0x04, 0x80
+};
+
+TEST_F(Core6502Tests_JIT, Test_Available)
+{
+    EXPECT_TRUE(jit->jit->available());
+}
+
+// Every opcode as the first instruction of a trace, from random state
+TEST_F(Core6502Tests_JIT, Test_Every_Opcode_Matches_Table)
+{
+    for (int opCode = 0; opCode < 0x100; opCode++) {
+        for (int i = 0; i < 4; i++) {
+
+            randomize();
+            tableMem[0x4000] = jitMem[0x4000] = opCode;
+
+            EXPECT_EQ(table->step(), jit->step()) << "opcode " << opCode;
+            expectSameState();
+
+        }
+    }
+}
+
+// Every opcode again with I/O mapped over the data pages, so loads and stores take the slow path
+TEST_F(Core6502Tests_JIT, Test_Every_Opcode_Through_IO)
+{
+    struct IO {
+        static uint8_t read(void * context, uint16_t addr) { return ((uint8_t *)context)[addr]; }
+        static void write(void * context, uint16_t addr, uint8_t value) { ((uint8_t *)context)[addr] = value; }
+    };
+
+    for (int opCode = 0; opCode < 0x100; opCode++) {
+
+        randomize();
+        tableMem[0x4000] = jitMem[0x4000] = opCode;
+
+        table->bus.mapIO(0x0000, 0x4000, IO::read, IO::write, &tableMem[0]);
+        table->bus.mapIO(0x4100, 0xBF00, IO::read, IO::write, &tableMem[0]);
+        jit->bus.mapIO(0x0000, 0x4000, IO::read, IO::write, &jitMem[0]);
+        jit->bus.mapIO(0x4100, 0xBF00, IO::read, IO::write, &jitMem[0]);
+
+        EXPECT_EQ(table->step(), jit->step()) << "opcode " << opCode;
+        expectSameState();
+
+    }
+}
+
+TEST_F(Core6502Tests_JIT, Test_NSum_Matches_Table)
+{
+    load(nSum, sizeof(nSum));
+
+    EXPECT_EQ(table->runUntil(0x800B, 10000), jit->runUntil(0x800B, 10000));
+
+    expectSameState();
+    EXPECT_EQ(jit->registers.A, 55);
+    EXPECT_GT(jit->jit->translations, 0);
+}
+
+TEST_F(Core6502Tests_JIT, Test_Run_Matches_Clock_At_Every_Length)
+{
+    load(nSum, sizeof(nSum));
+
+    // Budgets that end inside a trace must stop at the same instruction as the table core
+    for (uint32_t cycles = 1; cycles < 60; cycles++) {
+        EXPECT_EQ(table->run(cycles), jit->run(cycles));
+        expectSameState();
+    }
+}
+
+TEST_F(Core6502Tests_JIT, Test_Stops_Inside_Trace)
+{
+    load(nSum, sizeof(nSum));
+
+    // 0x8008 (DEX) sits in the middle of the loop
+    for (int i = 0; i < 5; i++) {
+        table->runUntil(0x8008, 10000);
+        jit->runUntil(0x8008, 10000);
+        expectSameState();
+    }
+}
+
+TEST_F(Core6502Tests_JIT, Test_Self_Modifying_Code)
+{
+    // Each pass rewrites the immediate of the following LDA inside the same trace:
+    //  8000: LDX #$05
+    //  8002: TXA
+    //  8003: STA $8007
+    //  8006: LDA #$00      <- operand patched to X
+    //  8008: STA $0300,X
+    //  800B: DEX
+    //  800C: BNE $8002
+    //  800E: NOP
+    const uint8_t program[] = {
+        0xA2, 0x05, 0x8A, 0x8D, 0x07, 0x80, 0xA9, 0x00, 0x9D, 0x00, 0x03,
+        0xCA, 0xD0, 0xF4, 0xEA
+    };
+    load(program, sizeof(program));
+
+    table->runUntil(0x800E, 10000);
+    jit->runUntil(0x800E, 10000);
+
+    expectSameState();
+    for (int i = 1; i <= 5; i++) EXPECT_EQ(jitMem[0x0300 + i], i);
+}
+
+TEST_F(Core6502Tests_JIT, Test_Remap_Flushes)
+{
+    // Two ROM banks at 0xC000 with different LDA immediates, JMP back to the start
+    uint8_t bankA[0x100] = {0xA9, 0x11, 0x4C, 0x00, 0xC0};
+    uint8_t bankB[0x100] = {0xA9, 0x22, 0x4C, 0x00, 0xC0};
+
+    jit->bus.mapROM(0xC000, sizeof(bankA), bankA);
+    jit->registers.PC = 0xC000;
+    jit->run(100);
+    EXPECT_EQ(jit->registers.A, 0x11);
+
+    jit->bus.mapROM(0xC000, sizeof(bankB), bankB);
+    jit->registers.PC = 0xC000;
+    jit->run(100);
+    EXPECT_EQ(jit->registers.A, 0x22);
+}
+
+// Random code including branches, jumps, calls and stores into the code itself
+TEST_F(Core6502Tests_JIT, Test_Random_Code_Matches_Table)
+{
+    for (int round = 0; round < 50; round++) {
+
+        randomize();
+
+        for (int i = 0; i < 50; i++) {
+            uint32_t cycles = 1 + random();
+            EXPECT_EQ(table->run(cycles), jit->run(cycles));
+        }
+
+        expectSameState();
+    }
+}
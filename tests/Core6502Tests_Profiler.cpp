@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include <sstream>
+#include <string>
+#include "Core6502.hpp"
+#include "Core6502Profiler.hpp"
+
+class Core6502Tests_Profiler : public testing::Test
+{
+public:
+	uint8_t mem[0x10000];
+	Core6502::CPU *cpu;
+	Core6502::Profiler *profiler;
+	uint64_t cycle;
+
+	virtual void SetUp()
+	{
+        memset(mem, 0xEA, sizeof(mem));     // NOP everywhere
+        cpu = new Core6502::CPU(mem);
+        profiler = new Core6502::Profiler();
+        cycle = 0;
+	}
+
+	virtual void TearDown()
+	{
+        delete profiler;
+        delete cpu;
+	}
+
+    // Reports the instruction at pc with the stack pointer at sp, taking cycles
+    void report(uint16_t pc, uint8_t opCode, uint8_t sp, uint64_t cycles)
+    {
+        mem[pc] = opCode;
+        cpu->registers.PC = pc;
+        cpu->registers.SP = sp;
+        profiler->instruction(*cpu, cycle);
+        cycle += cycles;
+    }
+};
+
+// Validates opcode and address counts, charging each instruction up to the next one
+TEST_F(Core6502Tests_Profiler, Test_Counts) {
+
+    report(0x8000, 0xA9, 0xFF, 2);      // LDA #
+    report(0x8002, 0xEA, 0xFF, 2);      // NOP
+    report(0x8003, 0xA9, 0xFF, 5);      // LDA #, stretched
+    report(0x8005, 0xEA, 0xFF, 2);      // NOP, still pending
+    EXPECT_EQ(profiler->opcodes[0xEA].cycles, 2u);
+
+    cpu->totalCycles = cycle;
+    cpu->cyclesRemaining = 0;
+    profiler->finish(*cpu);
+
+    EXPECT_EQ(profiler->opcodes[0xA9].executions, 2u);
+    EXPECT_EQ(profiler->opcodes[0xA9].cycles, 7u);
+    EXPECT_EQ(profiler->opcodes[0xEA].executions, 2u);
+    EXPECT_EQ(profiler->opcodes[0xEA].cycles, 4u);
+    EXPECT_EQ(profiler->addresses[0x8003].executions, 1u);
+    EXPECT_EQ(profiler->addresses[0x8003].cycles, 5u);
+    EXPECT_EQ(profiler->instructions(), 4u);
+    EXPECT_EQ(profiler->cycles(), 11u);
+
+    std::stringstream flat;
+    profiler->writeFlat(flat);
+    std::string text = flat.str();
+    EXPECT_NE(text.find("# 4 instructions, 11 cycles"), std::string::npos);
+    EXPECT_NE(text.find("A9 LDA IMM"), std::string::npos);
+    EXPECT_NE(text.find("$8003"), std::string::npos);
+    EXPECT_LT(text.find("A9 LDA IMM"), text.find("EA NOP IMP"));     // Most cycles first
+
+    profiler->clear();
+    EXPECT_EQ(profiler->instructions(), 0u);
+    EXPECT_EQ(profiler->addresses[0x8003].executions, 0u);
+
+}
+
+// Validates calls and returns build the folded stacks
+TEST_F(Core6502Tests_Profiler, Test_Folded) {
+
+    report(0x8000, 0xEA, 0xFF, 2);      // NOP
+    report(0x8001, 0x20, 0xFF, 6);      // JSR $9000
+    report(0x9000, 0xEA, 0xFD, 2);      //   NOP
+    report(0x9001, 0x20, 0xFD, 6);      //   JSR $9100
+    report(0x9100, 0xEA, 0xFB, 2);      //     NOP
+    report(0x9101, 0x60, 0xFB, 6);      //     RTS
+    report(0x9004, 0x60, 0xFD, 6);      //   RTS
+    report(0x8004, 0x20, 0xFF, 6);      // JSR $9100
+    report(0x9100, 0xEA, 0xFD, 2);      //   NOP
+    report(0x9101, 0x60, 0xFD, 6);      //   RTS
+    report(0x8007, 0xEA, 0xFF, 2);      // NOP
+    report(0x8008, 0x60, 0xFF, 6);      // RTS with nothing to return to stays in the root
+    report(0x8009, 0xEA, 0x01, 2);
+    cpu->totalCycles = cycle;
+    profiler->finish(*cpu);
+
+    std::stringstream folded;
+    profiler->writeFolded(folded);
+    EXPECT_EQ(folded.str(),
+              "$8000 24\n"
+              "$8000;$9000 14\n"
+              "$8000;$9000;$9100 8\n"
+              "$8000;$9100 8\n");
+
+}
+
+// Validates interrupts that weren't followed don't unwind the call they interrupted
+TEST_F(Core6502Tests_Profiler, Test_UnfollowedInterrupt) {
+
+    report(0x8000, 0x20, 0xFF, 6);      // JSR $9000
+    report(0x9000, 0xEA, 0xFD, 2);      //   NOP, then an IRQ pushes 3 bytes
+    report(0xA000, 0x40, 0xFA, 6);      //   RTI
+    report(0x9001, 0xEA, 0xFD, 2);      //   NOP, still in $9000
+    report(0x9002, 0x60, 0xFD, 6);      //   RTS
+    report(0x8003, 0xEA, 0xFF, 2);
+    cpu->totalCycles = cycle;
+    profiler->finish(*cpu);
+
+    std::stringstream folded;
+    profiler->writeFolded(folded);
+    EXPECT_EQ(folded.str(), "$8000 8\n$8000;$9000 16\n");
+
+}
+
+#ifdef CORE6502_PROFILE
+
+// Runs LDX #$10; JSR $9000; DEX; BNE -6 with $9000: RTS, and checks what every core counted
+static void expectProfiled(uint8_t * mem, Core6502::Interpreter interpreter, bool clocked) {
+
+    const uint8_t program[] = {0xA2, 0x10, 0x20, 0x00, 0x90, 0xCA, 0xD0, 0xFA};
+    memcpy(&mem[0x8000], program, sizeof(program));
+    mem[0x9000] = 0x60;
+    mem[0x01FD] = 0x80;         // RTS takes its high byte from the slot below the return address
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x80;
+
+    Core6502::CPU * cpu = new Core6502::CPU(mem, interpreter);
+    cpu->reset();
+    cpu->cyclesRemaining = 0;
+    cpu->registers.SP = 0xFF;
+
+    Core6502::Profiler profiler;
+    cpu->profiler = &profiler;
+
+    if (clocked) {
+        while (cpu->registers.PC != 0x8008 || cpu->cyclesRemaining) cpu->clock();
+    } else {
+        cpu->runUntil(0x8008, 10000);
+    }
+    profiler.finish(*cpu);
+
+    EXPECT_EQ(profiler.opcodes[0xA2].executions, 1u);
+    EXPECT_EQ(profiler.opcodes[0x20].executions, 16u);
+    EXPECT_EQ(profiler.opcodes[0x20].cycles, 16u * 6);
+    EXPECT_EQ(profiler.opcodes[0x60].executions, 16u);
+    EXPECT_EQ(profiler.opcodes[0x60].cycles, 16u * 6);
+    EXPECT_EQ(profiler.opcodes[0xCA].executions, 16u);
+    EXPECT_EQ(profiler.addresses[0x8006].executions, 16u);
+    EXPECT_EQ(profiler.addresses[0x9000].executions, 16u);
+    EXPECT_EQ(profiler.cycles(), cpu->totalCycles + cpu->cyclesRemaining);
+
+    std::stringstream folded;
+    profiler.writeFolded(folded);
+    EXPECT_NE(folded.str().find("$8000;$9000 96\n"), std::string::npos);
+
+    cpu->profiler = NULL;
+    delete cpu;
+
+}
+
+// Validates every core reports each instruction
+TEST_F(Core6502Tests_Profiler, Test_CoresProfile) {
+
+    expectProfiled(mem, Core6502::Interpreter::Table, false);
+    expectProfiled(mem, Core6502::Interpreter::Switch, false);
+    expectProfiled(mem, Core6502::Interpreter::Cached, false);
+    expectProfiled(mem, Core6502::Interpreter::Table, true);
+    expectProfiled(mem, Core6502::Interpreter::Cached, true);
+#ifdef CORE6502_JIT
+    expectProfiled(mem, Core6502::Interpreter::JIT, false);
+#endif
+
+}
+
+#endif
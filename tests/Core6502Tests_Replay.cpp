@@ -0,0 +1,267 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include <sstream>
+#include "Core6502.hpp"
+#include "Core6502Replay.hpp"
+#include "Core6502Scheduler.hpp"
+
+// Main loop sums reads of $D000 into $10, the IRQ handler counts into $11 and adds $D001 into
+// $12, the NMI handler counts into $13.  Device registers change on every read.  Handlers
+// reset the stack and jump back to the loop rather than RTI.
+static const uint8_t program[] = {
+    0x58,               // 8000 CLI
+    0xAD, 0x00, 0xD0,   // 8001 LDA $D000
+    0x18,               // 8004 CLC
+    0x65, 0x10,         // 8005 ADC $10
+    0x85, 0x10,         // 8007 STA $10
+    0xA2, 0x03,         // 8009 LDX #$03
+    0xCA,               // 800B DEX
+    0xD0, 0xFD,         // 800C BNE $800B
+    0x4C, 0x01, 0x80,   // 800E JMP $8001
+};
+
+static const uint8_t irqHandler[] = {
+    0xE6, 0x11,         // 9000 INC $11
+    0xAD, 0x01, 0xD0,   // 9002 LDA $D001
+    0x18,               // 9005 CLC
+    0x65, 0x12,         // 9006 ADC $12
+    0x85, 0x12,         // 9008 STA $12
+    0xA2, 0xFF,         // 900A LDX #$FF
+    0x9A,               // 900C TXS
+    0x4C, 0x01, 0x80,   // 900D JMP $8001
+};
+
+static const uint8_t nmiHandler[] = {
+    0xE6, 0x13,         // 9100 INC $13
+    0xA2, 0xFF,         // 9102 LDX #$FF
+    0x9A,               // 9104 TXS
+    0x4C, 0x01, 0x80,   // 9105 JMP $8001
+};
+
+struct Device {
+    uint8_t value;
+    uint32_t reads;
+};
+
+static uint8_t deviceRead(void * context, uint16_t addr) {
+    Device & device = *(Device *)context;
+    device.reads++;
+    device.value = device.value * 5 + 3 + (addr & 0xFF);
+    return device.value;
+}
+
+static void timerFired(Core6502::CPU & cpu, uint64_t cycle, void * context) {
+    cpu.irq();
+    if (cycle < 4000) cpu.scheduler->schedule(cycle + 333, timerFired);
+}
+
+class Core6502Tests_Replay : public testing::Test
+{
+public:
+    uint8_t mem[0x10000];
+	Core6502::CPU *cpu;
+    Device device;
+
+	virtual void SetUp()
+	{
+        memset(mem, 0, sizeof(mem));
+        load(mem);
+
+        device.value = 0x11;
+        device.reads = 0;
+
+        cpu = new Core6502::CPU(mem);
+        cpu->reset();
+        cpu->bus.mapIO(0xD000, 0x100, deviceRead, NULL, &device);
+	}
+
+	virtual void TearDown()
+	{
+        delete cpu;
+	}
+
+    static void load(uint8_t * image)
+    {
+        memcpy(&image[0x8000], program, sizeof(program));
+        memcpy(&image[0x9000], irqHandler, sizeof(irqHandler));
+        memcpy(&image[0x9100], nmiHandler, sizeof(nmiHandler));
+        image[0xFFFC] = 0x00;
+        image[0xFFFD] = 0x80;
+        image[0xFFFE] = 0x00;
+        image[0xFFFF] = 0x90;
+        image[0xFFFA] = 0x91;   // nmi() reads the vector high byte first here
+        image[0xFFFB] = 0x00;
+    }
+
+    // Runs the program with interrupts from the host between runs and from a timer
+    void drive(Core6502::CPU & target)
+    {
+        Core6502::Scheduler scheduler;
+        target.scheduler = &scheduler;
+        scheduler.schedule(target.totalCycles + 100, timerFired);
+
+        for (int i = 0; i < 20; i++) {
+            target.run(97 + i * 13);
+            if (i % 3 == 0) target.irq();
+            if (i % 7 == 3) target.nmi();
+        }
+
+        target.scheduler = NULL;
+    }
+
+    // Compares everything the replayed CPU should have reproduced
+    void expectSame(const Core6502::CPU & replayed, const uint8_t * replayedMem)
+    {
+        EXPECT_EQ(replayed.registers.PC, cpu->registers.PC);
+        EXPECT_EQ(replayed.registers.SP, cpu->registers.SP);
+        EXPECT_EQ(replayed.registers.A, cpu->registers.A);
+        EXPECT_EQ(replayed.registers.X, cpu->registers.X);
+        EXPECT_EQ(replayed.registers.Y, cpu->registers.Y);
+        EXPECT_EQ(replayed.status.raw, cpu->status.raw);
+        EXPECT_EQ(replayed.totalCycles, cpu->totalCycles);
+        EXPECT_EQ(replayed.cyclesRemaining, cpu->cyclesRemaining);
+        EXPECT_EQ(memcmp(replayedMem, mem, 0x10000), 0);
+    }
+};
+
+// Validates a replay without the device or the timer reaches the recorded state
+TEST_F(Core6502Tests_Replay, Test_Replay) {
+
+    std::stringstream log;
+
+    Core6502::Recorder * recorder = new Core6502::Recorder(*cpu, log);
+    EXPECT_EQ(cpu->recorder, recorder);
+    drive(*cpu);
+    recorder->finish();
+
+    EXPECT_TRUE(recorder->good());
+    EXPECT_EQ(cpu->recorder, (Core6502::Recorder *)NULL);
+    EXPECT_GT(device.reads, 100u);
+    EXPECT_GT(mem[0x11], 10);
+    EXPECT_GT(mem[0x13], 0);
+
+    // Every read and interrupt logged, device reads being the only reads off RAM
+    uint64_t interrupts = recorder->events - device.reads;
+    delete recorder;
+
+    // Fresh CPU and memory, nothing mapped where the device was
+    uint8_t * replayMem = new uint8_t[0x10000];
+    memset(replayMem, 0xFF, 0x10000);
+
+    Core6502::CPU * replayed = new Core6502::CPU(replayMem);
+    replayed->bus.unmap(0xD000, 0x100);
+
+    Core6502::Replayer replayer(*replayed, log);
+    ASSERT_TRUE(replayer.good()) << replayer.error;
+    EXPECT_TRUE(replayer.run()) << replayer.error;
+    EXPECT_EQ(replayer.events, device.reads + interrupts);
+
+    expectSame(*replayed, replayMem);
+
+    delete replayed;
+    delete[] replayMem;
+
+}
+
+// Validates each core replays the same log, including the JIT and cached cores
+TEST_F(Core6502Tests_Replay, Test_Replay_Cores) {
+
+    std::stringstream log;
+    {
+        Core6502::Recorder recorder(*cpu, log);
+        drive(*cpu);
+    }
+    std::string recorded = log.str();
+
+    const Core6502::Interpreter interpreters[] = {
+        Core6502::Interpreter::Table,
+        Core6502::Interpreter::Switch,
+        Core6502::Interpreter::Cached,
+#ifdef CORE6502_JIT
+        Core6502::Interpreter::JIT,
+#endif
+    };
+
+    for (Core6502::Interpreter interpreter : interpreters) {
+
+        uint8_t * replayMem = new uint8_t[0x10000];
+        Core6502::CPU * replayed = new Core6502::CPU(replayMem, interpreter);
+        replayed->bus.unmap(0xD000, 0x100);
+
+        std::istringstream in(recorded);
+        Core6502::Replayer replayer(*replayed, in);
+        EXPECT_TRUE(replayer.run()) << (int)interpreter << " " << replayer.error;
+        expectSame(*replayed, replayMem);
+
+        delete replayed;
+        delete[] replayMem;
+
+    }
+
+}
+
+// Validates a cut short or foreign log fails instead of running on with made up input
+TEST_F(Core6502Tests_Replay, Test_Bad_Logs) {
+
+    std::stringstream log;
+    {
+        Core6502::Recorder recorder(*cpu, log);
+        drive(*cpu);
+    }
+    std::string recorded = log.str();
+
+    uint8_t * replayMem = new uint8_t[0x10000];
+    Core6502::CPU * replayed = new Core6502::CPU(replayMem);
+
+    // Missing End and the last few events
+    {
+        std::istringstream in(recorded.substr(0, recorded.size() - 10));
+        Core6502::Replayer replayer(*replayed, in);
+        ASSERT_TRUE(replayer.good());
+        EXPECT_FALSE(replayer.run());
+        EXPECT_NE(replayer.error, (const char *)NULL);
+    }
+
+    // Not a replay log
+    {
+        std::string foreign = recorded;
+        foreign[0] = 'X';
+        std::istringstream in(foreign);
+        Core6502::Replayer replayer(*replayed, in);
+        EXPECT_FALSE(replayer.good());
+        EXPECT_FALSE(replayer.run());
+    }
+
+    // Replayer detaches from the bus when done
+    EXPECT_EQ(replayed->bus.input, (Core6502::Bus::InputCallback)NULL);
+
+    delete replayed;
+    delete[] replayMem;
+
+}
+
+// Validates reads after the CPU diverges from the log are caught
+TEST_F(Core6502Tests_Replay, Test_Divergence) {
+
+    std::stringstream log;
+    {
+        Core6502::Recorder recorder(*cpu, log);
+        drive(*cpu);
+    }
+
+    uint8_t * replayMem = new uint8_t[0x10000];
+    Core6502::CPU * replayed = new Core6502::CPU(replayMem);
+    replayed->bus.unmap(0xD000, 0x100);
+
+    Core6502::Replayer replayer(*replayed, log);
+    ASSERT_TRUE(replayer.good());
+
+    // Different program from the same start state: reads $D002 instead of $D000
+    replayMem[0x8002] = 0x02;
+    EXPECT_FALSE(replayer.run());
+    EXPECT_STREQ(replayer.error, "read address differs from the log");
+
+    delete replayed;
+    delete[] replayMem;
+
+}
@@ -0,0 +1,306 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include <vector>
+#include "Core6502.hpp"
+#include "Core6502Debugger.hpp"
+#include "Core6502Rewind.hpp"
+#include "Core6502Scheduler.hpp"
+
+// Main loop sums reads of $D000 into $10 and keeps its sums in $20-$5F, the IRQ
+// handler counts into $11 and adds $D001 into $12.  The handler resets the stack and jumps
+// back to the loop rather than RTI.
+static const uint8_t program[] = {
+    0x58,               // 8000 CLI
+    0xAD, 0x00, 0xD0,   // 8001 LDA $D000
+    0x18,               // 8004 CLC
+    0x65, 0x10,         // 8005 ADC $10
+    0x85, 0x10,         // 8007 STA $10
+    0xA6, 0x14,         // 8009 LDX $14
+    0x95, 0x20,         // 800B STA $20,X
+    0xE8,               // 800D INX
+    0x8A,               // 800E TXA
+    0x29, 0x3F,         // 800F AND #$3F
+    0x85, 0x14,         // 8011 STA $14
+    0x4C, 0x01, 0x80,   // 8013 JMP $8001
+};
+
+static const uint8_t irqHandler[] = {
+    0xE6, 0x11,         // 9000 INC $11
+    0xAD, 0x01, 0xD0,   // 9002 LDA $D001
+    0x18,               // 9005 CLC
+    0x65, 0x12,         // 9006 ADC $12
+    0x85, 0x12,         // 9008 STA $12
+    0xA2, 0xFF,         // 900A LDX #$FF
+    0x9A,               // 900C TXS
+    0x4C, 0x01, 0x80,   // 900D JMP $8001
+};
+
+struct Device {
+    uint8_t value;
+    uint32_t reads;
+    uint32_t writes;
+};
+
+static uint8_t deviceRead(void * context, uint16_t addr) {
+    Device & device = *(Device *)context;
+    device.reads++;
+    device.value = device.value * 5 + 3 + (addr & 0xFF);
+    return device.value;
+}
+
+static void deviceWrite(void * context, uint16_t addr, uint8_t value) {
+    ((Device *)context)->writes++;
+}
+
+static void timerFired(Core6502::CPU & cpu, uint64_t cycle, void * context) {
+    cpu.irq();
+    cpu.scheduler->schedule(cycle + 211, timerFired);
+}
+
+// A CPU with the device and a periodic timer interrupt
+struct System {
+    uint8_t mem[0x10000];
+    Core6502::CPU * cpu;
+    Core6502::Scheduler scheduler;
+    Device device;
+
+    System() {
+        memset(mem, 0, sizeof(mem));
+        memcpy(&mem[0x8000], program, sizeof(program));
+        memcpy(&mem[0x9000], irqHandler, sizeof(irqHandler));
+        mem[0xFFFC] = 0x00;
+        mem[0xFFFD] = 0x80;
+        mem[0xFFFE] = 0x00;
+        mem[0xFFFF] = 0x90;
+
+        device.value = 0x11;
+        device.reads = 0;
+        device.writes = 0;
+
+        cpu = new Core6502::CPU(mem);
+        cpu->reset();
+        cpu->bus.mapIO(0xD000, 0x100, deviceRead, deviceWrite, &device);
+        cpu->scheduler = &scheduler;
+        scheduler.schedule(150, timerFired);
+    }
+
+    ~System() {
+        delete cpu;
+    }
+};
+
+// Everything seek() should bring back
+struct Snapshot {
+    uint64_t totalCycles;
+    uint8_t cyclesRemaining;
+    uint16_t PC;
+    uint8_t SP, A, X, Y, P;
+    std::vector<uint8_t> mem;
+
+    Snapshot(const Core6502::CPU & cpu) : mem(cpu.mem, cpu.mem + 0x10000) {
+        totalCycles = cpu.totalCycles;
+        cyclesRemaining = cpu.cyclesRemaining;
+        PC = cpu.registers.PC;
+        SP = cpu.registers.SP;
+        A = cpu.registers.A;
+        X = cpu.registers.X;
+        Y = cpu.registers.Y;
+        P = cpu.status.raw;
+    }
+
+    bool operator==(const Snapshot & other) const {
+        return totalCycles == other.totalCycles && cyclesRemaining == other.cyclesRemaining &&
+            PC == other.PC && SP == other.SP && A == other.A && X == other.X && Y == other.Y &&
+            P == other.P && mem == other.mem;
+    }
+};
+
+class Core6502Tests_Rewind : public testing::Test
+{
+public:
+	System *system;
+    Core6502::Rewind *rewind;
+
+	virtual void SetUp()
+	{
+        system = new System();
+        rewind = new Core6502::Rewind(*system->cpu, system->scheduler, 500, 1 << 20);
+	}
+
+	virtual void TearDown()
+	{
+        delete rewind;
+        delete system;
+	}
+};
+
+// Validates seeking back to any earlier cycle restores the state the CPU had there
+TEST_F(Core6502Tests_Rewind, Test_Seek) {
+
+    Core6502::CPU & cpu = *system->cpu;
+
+    std::vector<Snapshot> snapshots;
+    snapshots.push_back(Snapshot(cpu));
+    for (int i = 0; i < 40; i++) {
+        cpu.run(37 + (i * 29) % 150);
+        if (i % 5 == 0) cpu.irq();
+        snapshots.push_back(Snapshot(cpu));
+    }
+
+    EXPECT_GT(system->device.reads, 100u);
+    EXPECT_GT(cpu.mem[0x11], 10);
+    EXPECT_GT(rewind->checkpoints, 5u);
+    EXPECT_EQ(rewind->earliest(), 0u);
+    EXPECT_EQ(rewind->latest(), cpu.totalCycles);
+
+    uint32_t reads = system->device.reads;
+
+    // Out of order, so seeks go backwards and forwards
+    for (size_t i = 0; i < snapshots.size(); i++) {
+        const Snapshot & snapshot = snapshots[(i * 17) % snapshots.size()];
+        ASSERT_TRUE(rewind->seek(snapshot.totalCycles)) << rewind->error;
+        EXPECT_TRUE(Snapshot(cpu) == snapshot) << snapshot.totalCycles;
+        EXPECT_FALSE(rewind->live() && snapshot.totalCycles != snapshots.back().totalCycles);
+    }
+
+    // Devices and the scheduler saw none of it
+    EXPECT_EQ(system->device.reads, reads);
+    EXPECT_EQ(system->device.writes, 0u);
+
+    EXPECT_FALSE(rewind->seek(rewind->latest() + 1));
+    EXPECT_NE(rewind->error, (const char *)NULL);
+
+}
+
+// Validates resume() returns to the present and carries on exactly as a CPU that never rewound
+TEST_F(Core6502Tests_Rewind, Test_Resume) {
+
+    System reference;
+
+    for (int i = 0; i < 10; i++) {
+        system->cpu->run(301);
+        reference.cpu->run(301);
+    }
+
+    ASSERT_TRUE(rewind->seek(1234)) << rewind->error;
+    EXPECT_FALSE(rewind->live());
+    EXPECT_EQ(system->cpu->scheduler, (Core6502::Scheduler *)NULL);
+
+    ASSERT_TRUE(rewind->resume()) << rewind->error;
+    EXPECT_TRUE(rewind->live());
+    EXPECT_EQ(system->cpu->scheduler, &system->scheduler);
+    EXPECT_TRUE(Snapshot(*system->cpu) == Snapshot(*reference.cpu));
+
+    for (int i = 0; i < 10; i++) {
+        system->cpu->run(333);
+        reference.cpu->run(333);
+        if (i == 4) {
+            system->cpu->irq();
+            reference.cpu->irq();
+        }
+    }
+
+    EXPECT_TRUE(Snapshot(*system->cpu) == Snapshot(*reference.cpu));
+    EXPECT_EQ(system->device.reads, reference.device.reads);
+
+    // And seeking over the time spent in the past still works
+    ASSERT_TRUE(rewind->seek(4000)) << rewind->error;
+    ASSERT_TRUE(rewind->resume()) << rewind->error;
+    EXPECT_TRUE(Snapshot(*system->cpu) == Snapshot(*reference.cpu));
+
+}
+
+// Validates stepBack() walks back through instruction boundaries, across checkpoints
+TEST_F(Core6502Tests_Rewind, Test_Step_Back) {
+
+    Core6502::CPU & cpu = *system->cpu;
+    cpu.run(880);
+
+    std::vector<Snapshot> boundaries;
+    for (int i = 0; i < 100; i++) {
+        cpu.step();
+        boundaries.push_back(Snapshot(cpu));
+    }
+    ASSERT_GT(cpu.totalCycles, 1000u);
+
+    for (size_t i = boundaries.size() - 1; i > 0; i--) {
+        ASSERT_TRUE(rewind->stepBack()) << rewind->error;
+        EXPECT_TRUE(Snapshot(cpu) == boundaries[i - 1]) << i;
+    }
+
+    // Back to the start of the first step, from a run that didn't end on a boundary
+    EXPECT_TRUE(rewind->stepBack()) << rewind->error;
+    EXPECT_LT(cpu.totalCycles, boundaries[0].totalCycles);
+    EXPECT_EQ(cpu.cyclesRemaining, 0);
+
+    ASSERT_TRUE(rewind->resume());
+    EXPECT_TRUE(Snapshot(cpu) == boundaries.back());
+
+}
+
+// Validates the budget drops the oldest checkpoints, and seeks stay within what's left
+TEST_F(Core6502Tests_Rewind, Test_Budget) {
+
+    Core6502::CPU & cpu = *system->cpu;
+
+    delete rewind;
+    rewind = new Core6502::Rewind(cpu, system->scheduler, 200, 2048);
+
+    for (int i = 0; i < 100; i++) cpu.run(250);
+
+    EXPECT_GT(rewind->dropped, 0u);
+    EXPECT_GE(rewind->checkpoints, 100u);
+    EXPECT_GT(rewind->earliest(), 0u);
+    EXPECT_LE(rewind->size(), 2048u + 1024u);
+
+    Snapshot present(cpu);
+    uint64_t earliest = rewind->earliest();
+
+    EXPECT_FALSE(rewind->seek(earliest - 1));
+    EXPECT_TRUE(rewind->seek(earliest)) << rewind->error;
+    EXPECT_EQ(cpu.totalCycles, earliest);
+    EXPECT_TRUE(rewind->seek(present.totalCycles - 1)) << rewind->error;
+
+    ASSERT_TRUE(rewind->resume());
+    EXPECT_TRUE(Snapshot(cpu) == present);
+
+}
+
+// Validates replays leave an armed debugger's watchpoints and last stop alone
+TEST_F(Core6502Tests_Rewind, Test_Watchpoint_Untouched) {
+
+    Core6502::CPU & cpu = *system->cpu;
+    for (int i = 0; i < 10; i++) cpu.run(301);
+
+    // STA $10 runs every time round the main loop
+    Core6502::Debugger debugger(cpu);
+    cpu.debugger = &debugger;
+    ASSERT_TRUE(debugger.addWatchpoint(0x0010, Core6502::Debugger::Write));
+
+    cpu.run(1000);
+    ASSERT_EQ(debugger.stopped, Core6502::Debugger::Stop::Watchpoint);
+    EXPECT_EQ(debugger.hits, 1u);
+
+    // Stop something else was recorded last, so a replay hitting the watchpoint would show
+    debugger.address = 0x1234;
+    debugger.access = 0;
+
+    ASSERT_TRUE(rewind->seek(1500)) << rewind->error;
+    ASSERT_TRUE(rewind->stepBack()) << rewind->error;
+    ASSERT_TRUE(rewind->resume()) << rewind->error;
+
+    EXPECT_EQ(cpu.debugger, &debugger);
+    EXPECT_EQ(debugger.hits, 1u);
+    EXPECT_EQ(debugger.stopped, Core6502::Debugger::Stop::Watchpoint);
+    EXPECT_EQ(debugger.address, 0x1234);
+    EXPECT_EQ(debugger.access, 0);
+
+    // And it still watches the present
+    cpu.run(1000);
+    EXPECT_EQ(debugger.hits, 2u);
+    EXPECT_EQ(debugger.address, 0x0010);
+    EXPECT_EQ(debugger.access, Core6502::Debugger::Write);
+
+    cpu.debugger = NULL;
+
+}
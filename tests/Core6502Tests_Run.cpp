@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include "Core6502.hpp"
+
+class Core6502Tests_Run : public testing::Test
+{
+public:
+    uint8_t memA[0x10000];
+    uint8_t memB[0x10000];
+	Core6502::CPU *clocked;
+	Core6502::CPU *batched;
+    
+	virtual void SetUp()
+	{  
+        // n_sum example program, N = 10
+        const uint8_t program[] = {
+            0xA9, 0x00, 0xA2, 0x0A, 0x86, 0x40, 0x65, 0x40, 0xCA,
+            0xD0, 0x04, 0xEA, 0x4C, 0x0B, 0x80, 0x4C, 0x04, 0x80
+        };
+
+        memset(memA, 0, sizeof(memA));
+        memcpy(&memA[0x8000], program, sizeof(program));
+        memA[0xFFFC] = 0x00;
+        memA[0xFFFD] = 0x80;
+        memcpy(memB, memA, sizeof(memA));
+
+        // Create CPUs
+        clocked = new Core6502::CPU(memA);
+        batched = new Core6502::CPU(memB);
+        clocked->reset();
+        batched->reset();
+	}
+
+	virtual void TearDown()
+	{
+        delete clocked;
+        delete batched;
+	}
+
+    void expectSameState()
+    {
+        EXPECT_EQ(clocked->registers.PC, batched->registers.PC);
+        EXPECT_EQ(clocked->registers.A, batched->registers.A);
+        EXPECT_EQ(clocked->registers.X, batched->registers.X);
+        EXPECT_EQ(clocked->status.raw, batched->status.raw);
+        EXPECT_EQ(clocked->cyclesRemaining, batched->cyclesRemaining);
+        EXPECT_EQ(clocked->totalCycles, batched->totalCycles);
+    }
+};
+
+// Validates run() lands on the same state as calling clock() once per cycle
+// for budgets that end both on and in the middle of instructions
+TEST_F(Core6502Tests_Run, Test_Run_Matches_Clock) {
+
+    for (uint32_t budget = 1; budget < 12; budget++) {
+        for (uint32_t i = 0; i < budget; i++) clocked->clock();
+        batched->run(budget);
+        expectSameState();
+    }
+
+}
+
+// Validates run() returns the overshoot of the last instruction
+TEST_F(Core6502Tests_Run, Test_Run_Overshoot) {
+
+    // LDA #$00 is 2 cycles, so a budget of 1 overshoots by 1
+    EXPECT_EQ(batched->run(1), 1);
+    EXPECT_EQ(batched->cyclesRemaining, 1);
+    EXPECT_EQ(batched->registers.PC, 0x8002);
+
+    // Consuming the overshoot and the 2 cycle LDX lands on a boundary
+    EXPECT_EQ(batched->run(3), 0);
+    EXPECT_EQ(batched->registers.PC, 0x8004);
+    EXPECT_EQ(batched->totalCycles, 4);
+
+}
+
+// Validates step() executes whole instructions
+TEST_F(Core6502Tests_Run, Test_Step) {
+
+    EXPECT_EQ(batched->step(), 2);
+    EXPECT_EQ(batched->registers.PC, 0x8002);
+
+    // A partially clocked instruction is finished before the next one executes
+    batched->clock();
+    EXPECT_EQ(batched->step(), 2 - 1 + 3);
+    EXPECT_EQ(batched->registers.PC, 0x8006);
+    EXPECT_EQ(batched->cyclesRemaining, 0);
+    EXPECT_EQ(batched->totalCycles, 7);
+
+}
+
+// Validates runUntil() stops at PC on an instruction boundary
+TEST_F(Core6502Tests_Run, Test_Run_Until_PC) {
+
+    uint32_t used = batched->runUntil(0x800B, 1000);
+
+    EXPECT_EQ(batched->registers.PC, 0x800B);
+    EXPECT_EQ(batched->registers.A, 55);
+    EXPECT_EQ(batched->cyclesRemaining, 0);
+    EXPECT_EQ(batched->totalCycles, used);
+    EXPECT_LT(used, 1000);
+
+    // Running the same number of cycles by clock lands on the same state
+    for (uint32_t i = 0; i < used; i++) clocked->clock();
+    expectSameState();
+
+}
+
+// Validates runUntil() gives up once the budget is used
+TEST_F(Core6502Tests_Run, Test_Run_Until_Budget) {
+
+    uint32_t used = batched->runUntil(0x1234, 100);
+
+    for (uint32_t i = 0; i < 100; i++) clocked->clock();
+
+    EXPECT_EQ(used, 100);
+    expectSameState();
+
+}
+
+static bool xIsFive(Core6502::CPU &cpu) {
+    return cpu.registers.X == 5;
+}
+
+// Validates runUntil() with a predicate
+TEST_F(Core6502Tests_Run, Test_Run_Until_Predicate) {
+
+    batched->runUntil(xIsFive, 1000);
+
+    EXPECT_EQ(batched->registers.X, 5);
+    EXPECT_EQ(batched->registers.PC, 0x8009);
+
+}
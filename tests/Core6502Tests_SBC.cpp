@@ -40,8 +40,7 @@ TEST_F(Core6502Tests_SBC, SBC_IMMEDIATE_POSITIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -72,8 +71,7 @@ TEST_F(Core6502Tests_SBC, SBC_IMMEDIATE_NEGATIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -103,8 +101,7 @@ TEST_F(Core6502Tests_SBC, SBC_IMMEDIATE_POSITIVE_WITH_CARRY) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -134,8 +131,7 @@ TEST_F(Core6502Tests_SBC, SBC_IMMEDIATE_NEGATIVE_WITH_CARRY) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -165,8 +161,7 @@ TEST_F(Core6502Tests_SBC, SBC_IMMEDIATE_POSITIVE_NEGATIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -196,8 +191,7 @@ TEST_F(Core6502Tests_SBC, SBC_IMMEDIATE_NEGATIVE_POSITIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -227,8 +221,7 @@ TEST_F(Core6502Tests_SBC, SBC_IMMEDIATE_POSITIVE_OVERFLOW) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -258,8 +251,7 @@ TEST_F(Core6502Tests_SBC, SBC_IMMEDIATE_NEGATIVE_OVERFLOW) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -289,8 +281,7 @@ TEST_F(Core6502Tests_SBC, SBC_IMMEDIATE_CARRY) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -325,8 +316,7 @@ TEST_F(Core6502Tests_SBC, SBC_ZERO_PAGE_POSITIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -361,8 +351,7 @@ TEST_F(Core6502Tests_SBC, SBC_ZERO_PAGE_NEGATIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -396,8 +385,7 @@ TEST_F(Core6502Tests_SBC, SBC_ZERO_PAGE_POSITIVE_WITH_CARRY) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -431,8 +419,7 @@ TEST_F(Core6502Tests_SBC, SBC_ZERO_PAGE_NEGATIVE_WITH_CARRY) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -466,8 +453,7 @@ TEST_F(Core6502Tests_SBC, SBC_ZERO_PAGE_POSITIVE_NEGATIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -501,8 +487,7 @@ TEST_F(Core6502Tests_SBC, SBC_ZERO_PAGE_NEGATIVE_POSITIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -536,8 +521,7 @@ TEST_F(Core6502Tests_SBC, SBC_ZERO_PAGE_POSITIVE_OVERFLOW) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -571,8 +555,7 @@ TEST_F(Core6502Tests_SBC, SBC_ZERO_PAGE_NEGATIVE_OVERFLOW) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -606,8 +589,7 @@ TEST_F(Core6502Tests_SBC, SBC_ZERO_PAGE_CARRY) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -643,8 +625,7 @@ TEST_F(Core6502Tests_SBC, SBC_ZERO_PAGE_X_POSITIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -680,8 +661,7 @@ TEST_F(Core6502Tests_SBC, SBC_ZERO_PAGE_X_NEGATIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -716,8 +696,7 @@ TEST_F(Core6502Tests_SBC, SBC_ZERO_PAGE_X_POSITIVE_WITH_CARRY) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -752,8 +731,7 @@ TEST_F(Core6502Tests_SBC, SBC_ZERO_PAGE_X_NEGATIVE_WITH_CARRY) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -788,8 +766,7 @@ TEST_F(Core6502Tests_SBC, SBC_ZERO_PAGE_X_POSITIVE_NEGATIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -824,8 +801,7 @@ TEST_F(Core6502Tests_SBC, SBC_ZERO_PAGE_X_NEGATIVE_POSITIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -860,8 +836,7 @@ TEST_F(Core6502Tests_SBC, SBC_ZERO_PAGE_X_POSITIVE_OVERFLOW) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -896,8 +871,7 @@ TEST_F(Core6502Tests_SBC, SBC_ZERO_PAGE_X_NEGATIVE_OVERFLOW) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -932,8 +906,7 @@ TEST_F(Core6502Tests_SBC, SBC_ZERO_PAGE_X_CARRY) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -972,8 +945,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_POSITIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1012,8 +984,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_NEGATIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1051,8 +1022,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_POSITIVE_WITH_CARRY) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1090,8 +1060,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_NEGATIVE_WITH_CARRY) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1129,8 +1098,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_POSITIVE_NEGATIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1168,8 +1136,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_NEGATIVE_POSITIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1207,8 +1174,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_POSITIVE_OVERFLOW) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1246,8 +1212,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_NEGATIVE_OVERFLOW) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1285,8 +1250,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_CARRY) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1325,8 +1289,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_X_POSITIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1365,8 +1328,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_X_NEGATIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1404,8 +1366,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_X_POSITIVE_WITH_CARRY) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1443,8 +1404,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_X_NEGATIVE_WITH_CARRY) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1482,8 +1442,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_X_POSITIVE_NEGATIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1521,8 +1480,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_X_NEGATIVE_POSITIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1560,8 +1518,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_X_POSITIVE_OVERFLOW) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1599,8 +1556,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_X_NEGATIVE_OVERFLOW) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1638,8 +1594,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_X_CARRY) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1678,8 +1633,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_Y_POSITIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1718,8 +1672,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_Y_NEGATIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1757,8 +1710,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_Y_POSITIVE_WITH_CARRY) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1796,8 +1748,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_Y_NEGATIVE_WITH_CARRY) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1835,8 +1786,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_Y_POSITIVE_NEGATIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1874,8 +1824,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_Y_NEGATIVE_POSITIVE) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1913,8 +1862,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_Y_POSITIVE_OVERFLOW) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1952,8 +1900,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_Y_NEGATIVE_OVERFLOW) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
@@ -1991,8 +1938,7 @@ TEST_F(Core6502Tests_SBC, SBC_ABSOLUTE_Y_CARRY) {
 
 	// Overflow Check
 	bool overflow = false;
-	overflow =  (bool)((aVal & 0x80) & (testVal & 0x80) & ~(subVal & 0x80));
-    overflow |= (bool)(~(aVal & 0x80) & ~(testVal & 0x80) & (subVal & 0x80));
+	overflow = (bool)((aVal ^ testVal) & (aVal ^ subVal) & 0x80);
 
 	// Check values
 	EXPECT_EQ(cpu->registers.A, (uint8_t)(subVal));
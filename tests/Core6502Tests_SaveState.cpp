@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include <sstream>
+#include <vector>
+#include "Core6502.hpp"
+#include "Core6502SaveState.hpp"
+
+class Core6502Tests_SaveState : public testing::Test
+{
+public:
+    std::vector<uint8_t> mem;
+    std::vector<uint8_t> loadedMem;
+	Core6502::CPU *cpu;
+	Core6502::CPU *loaded;
+
+	virtual void SetUp()
+	{
+        mem.assign(0x10000, 0);
+        loadedMem.assign(0x10000, 0x55);
+
+        // Some structure: a filled page, a ramp, and scattered bytes
+        memset(&mem[0x2000], 0xFF, 0x100);
+        for (int i = 0; i < 0x300; i++) mem[0x4000 + i] = (uint8_t)i;
+        for (int i = 0; i < 0x10000; i += 0x777) mem[i] = (uint8_t)(i >> 4);
+
+        // Create CPUs
+        cpu = new Core6502::CPU(&mem[0]);
+        loaded = new Core6502::CPU(&loadedMem[0]);
+
+        cpu->registers.PC = 0x1234;
+        cpu->registers.SP = 0xF0;
+        cpu->registers.A = 0x11;
+        cpu->registers.X = 0x22;
+        cpu->registers.Y = 0x33;
+        cpu->status.raw = 0xC3;
+        cpu->cyclesRemaining = 3;
+        cpu->totalCycles = 0x123456789ull;
+	}
+
+	virtual void TearDown()
+	{
+        delete cpu;
+        delete loaded;
+	}
+
+    void expectLoaded()
+    {
+        EXPECT_EQ(loaded->registers.PC, 0x1234);
+        EXPECT_EQ(loaded->registers.SP, 0xF0);
+        EXPECT_EQ(loaded->registers.A, 0x11);
+        EXPECT_EQ(loaded->registers.X, 0x22);
+        EXPECT_EQ(loaded->registers.Y, 0x33);
+        EXPECT_EQ(loaded->status.raw, 0xC3);
+        EXPECT_EQ(loaded->cyclesRemaining, 3);
+        EXPECT_EQ(loaded->totalCycles, 0x123456789ull);
+        EXPECT_TRUE(loadedMem == mem);
+    }
+};
+
+// Validates a state reads back as written and is much smaller than memory
+TEST_F(Core6502Tests_SaveState, Test_Round_Trip) {
+
+    std::stringstream stream;
+    ASSERT_TRUE(Core6502::SaveState::write(stream, *cpu));
+    EXPECT_LT(stream.str().size(), 0x800u);
+
+    ASSERT_TRUE(Core6502::SaveState::read(stream, *loaded));
+    expectLoaded();
+
+}
+
+// Validates delta states against a base only store what differs
+TEST_F(Core6502Tests_SaveState, Test_Delta) {
+
+    std::vector<uint8_t> base = mem;
+    mem[0x0010] = 0x99;
+    mem[0x8000] ^= 0x01;
+
+    std::stringstream stream;
+    ASSERT_TRUE(Core6502::SaveState::write(stream, *cpu, &base[0]));
+    EXPECT_LT(stream.str().size(), 64u);
+
+    ASSERT_TRUE(Core6502::SaveState::read(stream, *loaded, &base[0]));
+    expectLoaded();
+
+}
+
+// Validates reads refuse states they can't load faithfully
+TEST_F(Core6502Tests_SaveState, Test_Rejects) {
+
+    std::vector<uint8_t> base = mem;
+    std::stringstream delta;
+    ASSERT_TRUE(Core6502::SaveState::write(delta, *cpu, &base[0]));
+    std::string state = delta.str();
+
+    // Missing or different base
+    std::stringstream noBase(state);
+    EXPECT_FALSE(Core6502::SaveState::read(noBase, *loaded));
+    base[0x100] ^= 1;
+    std::stringstream wrongBase(state);
+    EXPECT_FALSE(Core6502::SaveState::read(wrongBase, *loaded, &base[0]));
+    base[0x100] ^= 1;
+
+    // Truncated
+    std::stringstream truncated(state.substr(0, state.size() - 1));
+    EXPECT_FALSE(Core6502::SaveState::read(truncated, *loaded, &base[0]));
+
+    // Bad magic and newer versions
+    std::string corrupt = state;
+    corrupt[0] = 'X';
+    std::stringstream badMagic(corrupt);
+    EXPECT_FALSE(Core6502::SaveState::read(badMagic, *loaded, &base[0]));
+
+    corrupt = state;
+    corrupt[4] = Core6502::SaveState::Version + 1;
+    std::stringstream newer(corrupt);
+    EXPECT_FALSE(Core6502::SaveState::read(newer, *loaded, &base[0]));
+
+}
+
+// Validates a state cut off partway through its memory leaves the CPU as it was
+TEST_F(Core6502Tests_SaveState, Test_Truncated_Leaves_CPU) {
+
+    std::stringstream stream;
+    ASSERT_TRUE(Core6502::SaveState::write(stream, *cpu));
+    std::string state = stream.str();
+
+    std::vector<uint8_t> before = loadedMem;
+    loaded->registers.PC = 0x4321;
+    loaded->totalCycles = 7;
+
+    // Header, registers and some memory tokens, but not all of them
+    for (size_t length = 40; length < state.size(); length += 97) {
+        std::stringstream truncated(state.substr(0, length));
+        EXPECT_FALSE(Core6502::SaveState::read(truncated, *loaded)) << length;
+        EXPECT_TRUE(loadedMem == before) << length;
+        EXPECT_EQ(loaded->registers.PC, 0x4321) << length;
+        EXPECT_EQ(loaded->totalCycles, 7u) << length;
+    }
+
+}
+
+// Validates states follow each other in one stream
+TEST_F(Core6502Tests_SaveState, Test_Stream_Of_States) {
+
+    std::stringstream stream;
+
+    for (int i = 0; i < 3; i++) {
+        cpu->registers.A = i;
+        ASSERT_TRUE(Core6502::SaveState::write(stream, *cpu));
+    }
+
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(Core6502::SaveState::read(stream, *loaded));
+        EXPECT_EQ(loaded->registers.A, i);
+    }
+
+    EXPECT_TRUE(loadedMem == mem);
+
+}
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include <vector>
+#include "Core6502.hpp"
+#include "Core6502Scheduler.hpp"
+
+class Core6502Tests_Scheduler : public testing::Test
+{
+public:
+    uint8_t mem[0x10000];
+	Core6502::CPU *cpu;
+    Core6502::Scheduler *scheduler;
+
+	virtual void SetUp()
+	{
+        // NOPs everywhere, starting at 0x8000
+        memset(mem, 0xEA, sizeof(mem));
+        mem[0xFFFC] = 0x00;
+        mem[0xFFFD] = 0x80;
+
+        cpu = new Core6502::CPU(mem);
+        cpu->reset();
+        scheduler = new Core6502::Scheduler();
+        cpu->scheduler = scheduler;
+	}
+
+	virtual void TearDown()
+	{
+        delete cpu;
+        delete scheduler;
+	}
+};
+
+// Cycle and totalCycles of every event fired
+struct Firing {
+    uint64_t cycle;
+    uint64_t total;
+    int tag;
+};
+static std::vector<Firing> firings;
+
+static void record(Core6502::CPU & cpu, uint64_t cycle, void * context) {
+    firings.push_back((Firing){cycle, cpu.totalCycles, (int)(intptr_t)context});
+}
+
+// Validates events fire on their cycle, in cycle order then scheduling order
+TEST_F(Core6502Tests_Scheduler, Test_Order) {
+
+    firings.clear();
+    scheduler->schedule(10, record, (void *)1);
+    scheduler->schedule(5, record, (void *)2);
+    scheduler->schedule(5, record, (void *)3);
+    scheduler->schedule(1000, record, (void *)4);
+    EXPECT_EQ(scheduler->pending(), 4u);
+    EXPECT_EQ(scheduler->next(), 5u);
+
+    cpu->run(101);
+
+    ASSERT_EQ(firings.size(), 3u);
+    EXPECT_EQ(firings[0].tag, 2);
+    EXPECT_EQ(firings[1].tag, 3);
+    EXPECT_EQ(firings[2].tag, 1);
+
+    // Odd cycles land inside a NOP, the run stops there with the rest of it pending
+    EXPECT_EQ(firings[0].cycle, 5u);
+    EXPECT_EQ(firings[0].total, 5u);
+    EXPECT_EQ(firings[2].total, 10u);
+
+    EXPECT_EQ(cpu->totalCycles, 101u);
+    EXPECT_EQ(scheduler->pending(), 1u);
+    EXPECT_EQ(scheduler->fired, 3u);
+
+}
+
+// Validates running in slices leaves the CPU where one run would
+TEST_F(Core6502Tests_Scheduler, Test_Same_As_Unscheduled) {
+
+    uint8_t plainMem[0x10000];
+    memcpy(plainMem, mem, sizeof(mem));
+    Core6502::CPU * plain = new Core6502::CPU(plainMem);
+    plain->reset();
+
+    firings.clear();
+    for (int i = 1; i < 50; i++) scheduler->schedule(i * 7, record, NULL);
+
+    EXPECT_EQ(cpu->run(301), plain->run(301));
+    EXPECT_EQ(cpu->registers.PC, plain->registers.PC);
+    EXPECT_EQ(cpu->totalCycles, plain->totalCycles);
+    EXPECT_EQ(firings.size(), 43u);
+
+    delete plain;
+
+}
+
+static void periodic(Core6502::CPU & cpu, uint64_t cycle, void * context) {
+    (*(int *)context)++;
+    cpu.scheduler->schedule(cycle + 100, periodic, context);
+}
+
+// Validates callbacks can reschedule themselves, and cancel()
+TEST_F(Core6502Tests_Scheduler, Test_Periodic_And_Cancel) {
+
+    int ticks = 0;
+    scheduler->schedule(100, periodic, &ticks);
+
+    firings.clear();
+    uint32_t id = scheduler->schedule(250, record, NULL);
+    EXPECT_TRUE(scheduler->cancel(id));
+    EXPECT_FALSE(scheduler->cancel(id));
+
+    cpu->run(1000);
+    EXPECT_EQ(ticks, 10);
+    EXPECT_EQ(firings.size(), 0u);
+    EXPECT_EQ(scheduler->next(), 1100u);
+
+    scheduler->clear();
+    EXPECT_EQ(scheduler->pending(), 0u);
+    EXPECT_EQ(scheduler->next(), UINT64_MAX);
+
+}
+
+// Validates clock() and step() fire events as they pass them
+TEST_F(Core6502Tests_Scheduler, Test_Clock_And_Step) {
+
+    firings.clear();
+    scheduler->schedule(3, record, NULL);
+    scheduler->scheduleIn(*cpu, 6, record, NULL);
+
+    for (int i = 0; i < 3; i++) cpu->clock();
+    ASSERT_EQ(firings.size(), 1u);
+    EXPECT_EQ(firings[0].total, 3u);
+
+    cpu->step();
+    cpu->step();
+    ASSERT_EQ(firings.size(), 2u);
+    EXPECT_EQ(firings[1].total, 6u);
+
+}
+
+// Validates runUntil() still stops on PC with events in between
+TEST_F(Core6502Tests_Scheduler, Test_RunUntil) {
+
+    firings.clear();
+    scheduler->schedule(3, record, NULL);
+    scheduler->schedule(9, record, NULL);
+
+    EXPECT_EQ(cpu->runUntil(0x8005, 1000), 10u);
+    EXPECT_EQ(cpu->registers.PC, 0x8005);
+    EXPECT_EQ(firings.size(), 2u);
+
+}
+
+static void interrupt(Core6502::CPU & cpu, uint64_t cycle, void * context) {
+    cpu.irq();
+}
+
+static const Core6502::Interpreter interpreters[] = {
+    Core6502::Interpreter::Table,
+    Core6502::Interpreter::Switch,
+    Core6502::Interpreter::Cached,
+#ifdef CORE6502_JIT
+    Core6502::Interpreter::JIT,
+#endif
+};
+
+// Validates a CPU spinning until a timer interrupt skips straight to it, landing in the
+// handler on the same cycle as running every pass
+TEST_F(Core6502Tests_Scheduler, Test_Idle_Until_Interrupt) {
+
+    for (Core6502::Interpreter interpreter : interpreters) {
+
+        // JMP * at 0x8000, the IRQ handler spins on JMP * at 0x9000
+        uint8_t memA[0x10000], memB[0x10000];
+        memset(memA, 0, sizeof(memA));
+        memA[0x8000] = 0x4C; memA[0x8001] = 0x00; memA[0x8002] = 0x80;
+        memA[0x9000] = 0x4C; memA[0x9001] = 0x00; memA[0x9002] = 0x90;
+        memA[0xFFFC] = 0x00; memA[0xFFFD] = 0x80;
+        memA[0xFFFE] = 0x00; memA[0xFFFF] = 0x90;
+        memcpy(memB, memA, sizeof(memA));
+
+        Core6502::CPU * cpus[2] = {new Core6502::CPU(memA, interpreter), new Core6502::CPU(memB, interpreter)};
+        Core6502::Scheduler schedulers[2];
+
+        for (int i = 0; i < 2; i++) {
+            cpus[i]->reset();
+            cpus[i]->status.bitfield.InterruptDisable = 0;
+            cpus[i]->idleSkipping = i == 0;
+            cpus[i]->scheduler = &schedulers[i];
+            schedulers[i].schedule(100000, interrupt);
+            cpus[i]->run(150000);
+        }
+
+        EXPECT_GT(cpus[0]->idleCyclesSkipped, 0u);
+        EXPECT_EQ(cpus[0]->registers.PC, 0x9000);
+        EXPECT_EQ(cpus[0]->registers.PC, cpus[1]->registers.PC);
+        EXPECT_EQ(cpus[0]->registers.SP, cpus[1]->registers.SP);
+        EXPECT_EQ(cpus[0]->cyclesRemaining, cpus[1]->cyclesRemaining);
+        EXPECT_EQ(cpus[0]->totalCycles, cpus[1]->totalCycles);
+        EXPECT_EQ(schedulers[0].fired, 1u);
+
+        // Pushed the PC of the loop it interrupted
+        EXPECT_EQ(memA[0xFF], 0x80);
+        EXPECT_EQ(memA[0xFE], 0x00);
+
+        delete cpus[0];
+        delete cpus[1];
+
+    }
+
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include <vector>
+#include "Core6502.hpp"
+#include "Core6502Snapshot.hpp"
+
+class Core6502Tests_Snapshot : public testing::Test
+{
+public:
+    std::vector<uint8_t> mem;
+	Core6502::CPU *cpu;
+    Core6502::Snapshots *snapshots;
+
+	virtual void SetUp()
+	{
+        mem.assign(0x10000, 0);
+
+        // Counts $40 up, storing it through $0300,X
+        const uint8_t program[] = {
+            0xE6, 0x40,         // INC $40
+            0xA5, 0x40,         // LDA $40
+            0xAA,               // TAX
+            0x9D, 0x00, 0x03,   // STA $0300,X
+            0x4C, 0x00, 0x80    // JMP $8000
+        };
+
+        memcpy(&mem[0x8000], program, sizeof(program));
+        mem[0xFFFC] = 0x00;
+        mem[0xFFFD] = 0x80;
+
+        // Create CPU
+        cpu = new Core6502::CPU(&mem[0], Core6502::Interpreter::Cached);
+        cpu->reset();
+
+        snapshots = new Core6502::Snapshots(*cpu);
+	}
+
+	virtual void TearDown()
+	{
+        delete snapshots;
+        delete cpu;
+	}
+};
+
+// Validates restoring brings back registers, cycles and memory as they were
+TEST_F(Core6502Tests_Snapshot, Test_Restore) {
+
+    ASSERT_TRUE(snapshots->tracking());
+
+    cpu->run(1000);
+    std::vector<uint8_t> saved = mem;
+    uint16_t pc = cpu->registers.PC;
+    uint8_t a = cpu->registers.A;
+    uint8_t x = cpu->registers.X;
+    uint8_t status = cpu->status.raw;
+    uint8_t remaining = cpu->cyclesRemaining;
+    uint64_t total = cpu->totalCycles;
+
+    Core6502::Snapshot * snapshot = snapshots->take();
+    cpu->run(5000);
+    snapshots->restore(*snapshot);
+
+    EXPECT_TRUE(mem == saved);
+    EXPECT_EQ(cpu->registers.PC, pc);
+    EXPECT_EQ(cpu->registers.A, a);
+    EXPECT_EQ(cpu->registers.X, x);
+    EXPECT_EQ(cpu->status.raw, status);
+    EXPECT_EQ(cpu->cyclesRemaining, remaining);
+    EXPECT_EQ(cpu->totalCycles, total);
+
+    // Running on from the restore repeats the same run
+    cpu->run(5000);
+    std::vector<uint8_t> first = mem;
+    snapshots->restore(*snapshot);
+    cpu->run(5000);
+    EXPECT_TRUE(mem == first);
+
+    delete snapshot;
+
+}
+
+// Validates snapshots only copy pages written since the last one
+TEST_F(Core6502Tests_Snapshot, Test_Copies_Dirty_Pages) {
+
+    delete snapshots->take();
+    EXPECT_EQ(snapshots->pagesCopied, 0x100u);
+
+    // Zero page and page 3 change
+    cpu->run(100);
+    Core6502::Snapshot * snapshot = snapshots->take();
+    EXPECT_EQ(snapshots->pagesCopied, 0x102u);
+
+    // Nothing changed, nothing to copy either way
+    snapshots->restore(*snapshot);
+    delete snapshots->take();
+    EXPECT_EQ(snapshots->pagesCopied, 0x102u);
+
+    cpu->write(0x1234, 0x56);
+    snapshots->restore(*snapshot);
+    EXPECT_EQ(snapshots->pagesCopied, 0x103u);
+    EXPECT_EQ(mem[0x1234], 0x00);
+
+    delete snapshot;
+
+}
+
+// Validates snapshots outlive each other and branch from any point
+TEST_F(Core6502Tests_Snapshot, Test_Tree) {
+
+    Core6502::Snapshot * root = snapshots->take();
+    cpu->run(300);
+    Core6502::Snapshot * left = snapshots->take();
+    std::vector<uint8_t> leftMem = mem;
+
+    snapshots->restore(*root);
+    cpu->write(0x0400, 0x99);
+    Core6502::Snapshot * right = snapshots->take();
+    std::vector<uint8_t> rightMem = mem;
+
+    delete root;
+
+    snapshots->restore(*left);
+    EXPECT_TRUE(mem == leftMem);
+    snapshots->restore(*right);
+    EXPECT_TRUE(mem == rightMem);
+
+    delete left;
+    delete right;
+
+}
+
+// Validates writes through a mirror dirty the page they land on
+TEST_F(Core6502Tests_Snapshot, Test_Mirror) {
+
+    cpu->bus.mirror(0x2000, 0x100, 0x0000);
+    Core6502::Snapshot * snapshot = snapshots->take();
+
+    cpu->write(0x2010, 0xAB);
+    EXPECT_EQ(mem[0x0010], 0xAB);
+
+    snapshots->restore(*snapshot);
+    EXPECT_EQ(mem[0x0010], 0x00);
+
+    delete snapshot;
+
+}
+
+// Validates code restored under the block cache runs as restored, not as cached
+TEST_F(Core6502Tests_Snapshot, Test_Restored_Code_Runs) {
+
+    // LDA #$01 then JMP back, patched to LDA #$02 after the snapshot
+    const uint8_t program[] = { 0xA9, 0x01, 0x4C, 0x00, 0x90 };
+    memcpy(&mem[0x9000], program, sizeof(program));
+    snapshots->invalidate();
+
+    cpu->registers.PC = 0x9000;
+    Core6502::Snapshot * snapshot = snapshots->take();
+
+    cpu->write(0x9001, 0x02);
+    cpu->run(50);
+    EXPECT_EQ(cpu->registers.A, 0x02);
+
+    snapshots->restore(*snapshot);
+    cpu->run(50);
+    EXPECT_EQ(cpu->registers.A, 0x01);
+
+    delete snapshot;
+
+}
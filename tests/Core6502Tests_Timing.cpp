@@ -0,0 +1,220 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include "Core6502.hpp"
+
+class Core6502Tests_Timing : public testing::Test
+{
+public:
+    uint8_t mem[0x10000];
+	Core6502::CPU *cpu;
+
+	virtual void SetUp()
+	{
+        cpu = NULL;
+        memset(mem, 0, sizeof(mem));
+	}
+
+	virtual void TearDown()
+	{
+        delete cpu;
+	}
+
+    // Fresh CPU on the code already in mem, about to run the instruction at pc
+    void start(Core6502::Interpreter interpreter, uint16_t pc)
+    {
+        delete cpu;
+        cpu = new Core6502::CPU(mem, interpreter);
+        cpu->reset();
+        cpu->registers.PC = pc;
+    }
+
+    // Runs one instruction, returning its cycles once PC reaches next
+    uint32_t timeTo(uint16_t next)
+    {
+        uint32_t cycles = cpu->runUntil(next, 100);
+        EXPECT_EQ(cpu->registers.PC, next);
+        return cycles;
+    }
+};
+
+static const Core6502::Interpreter interpreters[] = {
+    Core6502::Interpreter::Table,
+    Core6502::Interpreter::Switch,
+    Core6502::Interpreter::Cached,
+#ifdef CORE6502_JIT
+    Core6502::Interpreter::JIT,
+#endif
+};
+
+struct TimedOpcode {
+    uint8_t opCode;
+    uint8_t cycles;
+    const char * operation;
+    const char * addressing;
+};
+
+static const TimedOpcode opcodes[0x100] = {
+#define CORE6502_OPCODE(opCode, cycles, operation, addressing) {opCode, cycles, #operation, #addressing},
+#include "Core6502OpcodeTable.hpp"
+#undef CORE6502_OPCODE
+};
+
+// Only reads take the page crossing cycle.  Stores and read-modify-writes always take it.
+static bool isRead(const char * operation)
+{
+    const char * reads[] = {"LDA", "LDX", "LDY", "ADC", "SBC", "AND", "ORA", "EOR", "CMP"};
+    for (size_t i = 0; i < sizeof(reads) / sizeof(reads[0]); i++)
+        if (strcmp(operation, reads[i]) == 0) return true;
+    return false;
+}
+
+// Validates every abs,X abs,Y and (zp),Y opcode with and without a page crossing
+TEST_F(Core6502Tests_Timing, Test_Indexed_Page_Crossing) {
+
+    int tested = 0;
+
+    for (int i = 0; i < 0x100; i++) {
+
+        const TimedOpcode & op = opcodes[i];
+        bool indirect = strcmp(op.addressing, "IZY") == 0;
+        bool indexY = indirect || strcmp(op.addressing, "ABY") == 0;
+        if (!indirect && !indexY && strcmp(op.addressing, "ABX") != 0) continue;
+
+        // abs,X/abs,Y off $20F0, (zp),Y through a pointer at $10 to $20F0
+        memset(mem, 0, sizeof(mem));
+        mem[0x8000] = op.opCode;
+        mem[0x8001] = indirect ? 0x10 : 0xF0;
+        mem[0x8002] = 0x20;
+        mem[0x0010] = 0xF0;
+        mem[0x0011] = 0x20;
+        uint16_t next = indirect ? 0x8002 : 0x8003;
+
+        for (Core6502::Interpreter interpreter : interpreters) {
+            for (int crossing = 0; crossing < 2; crossing++) {
+
+                start(interpreter, 0x8000);
+                uint8_t index = crossing ? 0x20 : 0x05;
+                if (indexY) cpu->registers.Y = index;
+                else cpu->registers.X = index;
+
+                uint32_t expected = op.cycles + (crossing && isRead(op.operation));
+                EXPECT_EQ(timeTo(next), expected) << op.operation << " " << op.addressing
+                    << " opcode " << (int)op.opCode << " crossing " << crossing
+                    << " interpreter " << (int)interpreter;
+
+            }
+        }
+
+        tested++;
+
+    }
+
+    EXPECT_EQ(tested, 32);
+
+}
+
+// Validates every branch not taken, taken on the same page, and taken forwards and backwards
+// onto another page
+TEST_F(Core6502Tests_Timing, Test_Branches) {
+
+    // Flag tested by each pair of branches, indexed by opcode >> 6: N, V, C, Z
+    const uint8_t flags[] = {0x40, 0x20, 0x01, 0x02};
+
+    struct Case {
+        uint16_t pc;
+        int8_t offset;
+        uint8_t cycles;
+    };
+    const Case taken[] = {
+        {0x8010, 0x10, 3},                  // Same page
+        {0x80F0, 0x20, 4},                  // Forwards onto the next page
+        {0x8002, -0x10, 4},                 // Backwards onto the previous page
+        {0x80FE, -0x01, 4},                 // Crossing counts from the next instruction, not the branch
+    };
+    const uint8_t branches[] = {0x10, 0x30, 0x50, 0x70, 0x90, 0xB0, 0xD0, 0xF0};
+
+    for (uint8_t opCode : branches) {
+
+        uint8_t flag = flags[opCode >> 6];
+        bool onSet = opCode & 0x20;
+
+        for (Core6502::Interpreter interpreter : interpreters) {
+            for (size_t i = 0; i < sizeof(taken) / sizeof(taken[0]); i++) {
+
+                const Case & c = taken[i];
+                uint16_t next = c.pc + 2;
+
+                memset(mem, 0, sizeof(mem));
+                mem[c.pc] = opCode;
+                mem[c.pc + 1] = (uint8_t)c.offset;
+
+                // Not taken
+                start(interpreter, c.pc);
+                cpu->status.raw = onSet ? 0 : flag;
+                EXPECT_EQ(timeTo(next), 2u) << "opcode " << (int)opCode << " case " << i
+                    << " interpreter " << (int)interpreter;
+
+                // Taken
+                start(interpreter, c.pc);
+                cpu->status.raw = onSet ? flag : 0;
+                EXPECT_EQ(timeTo(next + c.offset), c.cycles) << "opcode " << (int)opCode << " case " << i
+                    << " interpreter " << (int)interpreter;
+
+            }
+        }
+
+    }
+
+}
+
+// Validates clock() and step() see the extra cycles too
+TEST_F(Core6502Tests_Timing, Test_Clock_And_Step) {
+
+    // LDA $20F0,X with X = $20, then BNE back onto the previous page
+    mem[0x8000] = 0xBD;
+    mem[0x8001] = 0xF0;
+    mem[0x8002] = 0x20;
+    mem[0x8003] = 0xD0;
+    mem[0x8004] = 0x80;
+    mem[0x20F0 + 0x20] = 0x01;
+
+    for (Core6502::Interpreter interpreter : interpreters) {
+
+        start(interpreter, 0x8000);
+        cpu->registers.X = 0x20;
+        EXPECT_EQ(cpu->step(), 5);
+        EXPECT_EQ(cpu->step(), 4);
+        EXPECT_EQ(cpu->registers.PC, 0x7F85);
+
+        start(interpreter, 0x8000);
+        cpu->registers.X = 0x20;
+        int clocks = 0;
+        while (cpu->registers.PC != 0x7F85 || cpu->cyclesRemaining) {
+            cpu->clock();
+            clocks++;
+        }
+        EXPECT_EQ(clocks, 9);
+        EXPECT_EQ(cpu->totalCycles, 9u);
+
+    }
+
+}
+
+// Validates the extra cycles of a taken branch carry over into the next run() call
+TEST_F(Core6502Tests_Timing, Test_Run_Overshoot) {
+
+    // BEQ from $80F0 onto $8112, 4 cycles
+    mem[0x80F0] = 0xF0;
+    mem[0x80F1] = 0x20;
+
+    for (Core6502::Interpreter interpreter : interpreters) {
+
+        start(interpreter, 0x80F0);
+        cpu->status.raw = 0x02;
+        EXPECT_EQ(cpu->run(1), 3u);
+        EXPECT_EQ(cpu->registers.PC, 0x8112);
+        EXPECT_EQ(cpu->totalCycles, 1u);
+
+    }
+
+}
@@ -0,0 +1,224 @@
+#include <gtest/gtest.h>
+#include <string.h>
+#include <sstream>
+#include <vector>
+#include "Core6502.hpp"
+#include "Core6502Trace.hpp"
+
+class Core6502Tests_Trace : public testing::Test
+{
+public:
+	uint8_t mem[0x10000];
+
+	virtual void SetUp()
+	{
+        memset(mem, 0xEA, sizeof(mem));     // NOP everywhere
+
+        // LDA #$05; LDX #$10; STA $40,X; INX; BNE -3; JMP ($0300)
+        const uint8_t program[] = {0xA9, 0x05, 0xA2, 0x10, 0x95, 0x40, 0xE8, 0xD0, 0xFB, 0x6C, 0x00, 0x03};
+        memcpy(&mem[0x8000], program, sizeof(program));
+        mem[0x0300] = 0x00;
+        mem[0x0301] = 0x90;
+        mem[0xFFFC] = 0x00;
+        mem[0xFFFD] = 0x80;
+	}
+
+    Core6502::Trace::Record record(uint16_t pc, uint8_t opCode, uint8_t low, uint8_t high)
+    {
+        Core6502::Trace::Record record;
+        memset(&record, 0, sizeof(record));
+        record.PC = pc;
+        record.opCode = opCode;
+        record.operands[0] = low;
+        record.operands[1] = high;
+        return record;
+    }
+};
+
+// Validates the buffer keeps the newest records once it wraps
+TEST_F(Core6502Tests_Trace, Test_RingWraps) {
+
+    Core6502::CPU cpu(mem);
+    cpu.reset();
+
+    Core6502::Trace trace(6);
+    EXPECT_EQ(trace.capacity(), 7u);
+
+    for (int i = 0; i < 20; i++) {
+        cpu.registers.PC = 0x9000 + i;
+        cpu.registers.A = i;
+        trace.record(cpu, cpu.status.raw, 100 + i * 2);
+    }
+
+    EXPECT_EQ(trace.count(), 20u);
+
+    Core6502::Trace::Record records[16];
+    ASSERT_EQ(trace.copy(records, 16), 7u);
+    for (int i = 0; i < 7; i++) {
+        EXPECT_EQ(records[i].PC, 0x9000 + 13 + i);
+        EXPECT_EQ(records[i].A, 13 + i);
+        EXPECT_EQ(records[i].cycle, 100u + (13 + i) * 2);
+        EXPECT_EQ(records[i].opCode, 0xEA);
+    }
+
+    // Asking for fewer gives the newest
+    ASSERT_EQ(trace.copy(records, 3), 3u);
+    EXPECT_EQ(records[0].PC, 0x9000 + 17);
+    EXPECT_EQ(records[2].PC, 0x9000 + 19);
+
+    trace.clear();
+    EXPECT_EQ(trace.copy(records, 16), 0u);
+
+}
+
+// Validates instruction bytes are read without going through I/O handlers
+static int ioReads = 0;
+static uint8_t countingRead(void *, uint16_t) { ioReads++; return 0x42; }
+
+TEST_F(Core6502Tests_Trace, Test_RecordSkipsIO) {
+
+    Core6502::CPU cpu(mem);
+    cpu.bus.mapIO(0xD000, 0x100, countingRead, NULL, NULL);
+
+    Core6502::Trace trace(4);
+    cpu.registers.PC = 0xD000;
+    trace.record(cpu, 0, 0);
+    cpu.registers.PC = 0xCFFF;
+    trace.record(cpu, 0, 0);
+
+    Core6502::Trace::Record records[4];
+    ASSERT_EQ(trace.copy(records, 4), 2u);
+    EXPECT_EQ(records[0].opCode, 0);
+    EXPECT_EQ(records[1].opCode, 0xEA);
+    EXPECT_EQ(records[1].operands[0], 0);
+    EXPECT_EQ(ioReads, 0);
+
+}
+
+// Validates the disassembler's operand formats
+TEST_F(Core6502Tests_Trace, Test_Disassemble) {
+
+    EXPECT_EQ(Core6502::Trace::disassemble(record(0x8000, 0xEA, 0, 0)), "NOP");
+    EXPECT_EQ(Core6502::Trace::disassemble(record(0x8000, 0x0A, 0, 0)), "ASL A");
+    EXPECT_EQ(Core6502::Trace::disassemble(record(0x8000, 0xA9, 0x05, 0)), "LDA #$05");
+    EXPECT_EQ(Core6502::Trace::disassemble(record(0x8000, 0x95, 0x40, 0)), "STA $40,X");
+    EXPECT_EQ(Core6502::Trace::disassemble(record(0x8000, 0xB6, 0x40, 0)), "LDX $40,Y");
+    EXPECT_EQ(Core6502::Trace::disassemble(record(0x8000, 0x8D, 0x34, 0x12)), "STA $1234");
+    EXPECT_EQ(Core6502::Trace::disassemble(record(0x8000, 0xBD, 0x34, 0x12)), "LDA $1234,X");
+    EXPECT_EQ(Core6502::Trace::disassemble(record(0x8000, 0xA1, 0x20, 0)), "LDA ($20,X)");
+    EXPECT_EQ(Core6502::Trace::disassemble(record(0x8000, 0xB1, 0x20, 0)), "LDA ($20),Y");
+    EXPECT_EQ(Core6502::Trace::disassemble(record(0x8000, 0x6C, 0x00, 0x03)), "JMP ($0300)");
+    EXPECT_EQ(Core6502::Trace::disassemble(record(0x8007, 0xD0, 0xFB, 0)), "BNE $8004");
+
+    std::string line = Core6502::Trace::format(record(0x8000, 0x8D, 0x34, 0x12), 42);
+    EXPECT_NE(line.find("8000  8D 34 12"), std::string::npos);
+    EXPECT_NE(line.find("STA $1234"), std::string::npos);
+
+}
+
+// Validates a dump reads back with full cycle counts past 32 bits
+TEST_F(Core6502Tests_Trace, Test_DumpRoundTrip) {
+
+    Core6502::CPU cpu(mem);
+    Core6502::Trace trace(15);
+
+    const uint64_t start = 0xFFFFFFF0ull;
+    for (int i = 0; i < 24; i++) {
+        cpu.registers.PC = 0x8000 + i;
+        cpu.registers.Y = i;
+        trace.record(cpu, 0x24, start + i * 3);
+    }
+
+    std::stringstream dump;
+    ASSERT_TRUE(trace.write(dump));
+
+    std::vector<Core6502::Trace::Record> records;
+    std::vector<uint64_t> cycles;
+    ASSERT_TRUE(Core6502::Trace::read(dump, records, cycles));
+    ASSERT_EQ(records.size(), 15u);
+
+    for (int i = 0; i < 15; i++) {
+        EXPECT_EQ(records[i].PC, 0x8000 + 9 + i);
+        EXPECT_EQ(records[i].Y, 9 + i);
+        EXPECT_EQ(records[i].P, 0x24);
+        EXPECT_EQ(cycles[i], start + (9 + i) * 3);
+    }
+
+    // Not a dump
+    std::stringstream junk("C652 not a trace at all");
+    EXPECT_FALSE(Core6502::Trace::read(junk, records, cycles));
+
+    // A header claiming far more records than follow fails without allocating for them
+    std::string claimed = dump.str();
+    memset(&claimed[8], 0xFF, 4);
+    std::stringstream truncated(claimed);
+    EXPECT_FALSE(Core6502::Trace::read(truncated, records, cycles));
+    EXPECT_EQ(records.size(), 15u);
+    EXPECT_LT(records.capacity(), 1024u);
+
+}
+
+#ifdef CORE6502_TRACE
+
+// Runs the program with a trace attached and checks what every core recorded
+static void expectTraced(uint8_t * mem, Core6502::Interpreter interpreter, bool clocked) {
+
+    Core6502::CPU * cpu = new Core6502::CPU(mem, interpreter);
+    cpu->reset();
+    cpu->cyclesRemaining = 0;
+    uint64_t start = cpu->totalCycles;
+
+    Core6502::Trace trace(1023);
+    cpu->trace = &trace;
+
+    if (clocked) {
+        while (cpu->registers.PC < 0x9000 || cpu->cyclesRemaining) cpu->clock();
+    } else {
+        cpu->runUntil(0x9000, 10000);
+    }
+
+    // LDA, LDX, then 240 rounds of STA/INX/BNE, then JMP
+    std::vector<Core6502::Trace::Record> records(1024);
+    size_t count = trace.copy(records.data(), records.size());
+    ASSERT_EQ(count, 3u + 240 * 3);
+
+    EXPECT_EQ(records[0].PC, 0x8000);
+    EXPECT_EQ(records[0].opCode, 0xA9);
+    EXPECT_EQ(records[0].cycle, (uint32_t)start);
+    EXPECT_EQ(records[1].A, 0x05);
+    EXPECT_EQ(records[1].cycle, (uint32_t)start + 2);
+    EXPECT_EQ(records[2].X, 0x10);
+    EXPECT_EQ(records[2].cycle, (uint32_t)start + 4);
+
+    // Second time round the loop the zero flag is clear and X has moved on, after a taken BNE
+    EXPECT_EQ(records[5].PC, 0x8004);
+    EXPECT_EQ(records[5].X, 0x11);
+    EXPECT_EQ(records[5].P & 0x02, 0);
+    EXPECT_EQ(records[5].cycle, (uint32_t)start + 4 + 4 + 2 + 3);
+
+    // Last BNE falls through with Z set
+    EXPECT_EQ(records[count - 2].PC, 0x8007);
+    EXPECT_EQ(records[count - 2].P & 0x02, 0x02);
+    EXPECT_EQ(records[count - 1].PC, 0x8009);
+    EXPECT_EQ(records[count - 1].opCode, 0x6C);
+
+    cpu->trace = NULL;
+    delete cpu;
+
+}
+
+// Validates every core records each instruction with its registers and start cycle
+TEST_F(Core6502Tests_Trace, Test_CoresRecord) {
+
+    expectTraced(mem, Core6502::Interpreter::Table, false);
+    expectTraced(mem, Core6502::Interpreter::Switch, false);
+    expectTraced(mem, Core6502::Interpreter::Cached, false);
+    expectTraced(mem, Core6502::Interpreter::Table, true);
+    expectTraced(mem, Core6502::Interpreter::Cached, true);
+#ifdef CORE6502_JIT
+    expectTraced(mem, Core6502::Interpreter::JIT, false);
+#endif
+
+}
+
+#endif
@@ -0,0 +1,111 @@
+//
+//  main.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <chrono>
+#include "Core6502.hpp"
+
+// Runs Klaus Dormann's 6502 functional test (6502_functional_test.bin, assembled with the
+// default options: loaded at $0000, started at $0400).  Every failure is a branch or jump to
+// itself, and so is the success trap, so the image runs in large batches until the CPU
+// stops moving, then the trap it stopped on decides the result.
+//
+//  Core6502FunctionalTest <image> [success PC in hex] [table|switch|cached|jit]
+//
+// Exits 0 on success, 1 when the test traps anywhere else or the image is too short, and 77,
+// which CTest reports as skipped, when the image can't be opened.
+
+static const uint16_t startPC = 0x0400;
+static const uint32_t batchCycles = 1000000;
+static const uint64_t maxCycles = 1000000000ULL;
+
+static uint8_t mem[0x10000];
+
+static bool parseCore(const char * name, Core6502::Interpreter & interpreter) {
+
+	if (!strcmp(name, "table")) interpreter = Core6502::Interpreter::Table;
+	else if (!strcmp(name, "switch")) interpreter = Core6502::Interpreter::Switch;
+	else if (!strcmp(name, "cached")) interpreter = Core6502::Interpreter::Cached;
+#ifdef CORE6502_JIT
+	else if (!strcmp(name, "jit")) interpreter = Core6502::Interpreter::JIT;
+#endif
+	else return false;
+
+	return true;
+
+}
+
+// True when the instruction at PC branches or jumps to itself
+static bool trapped(Core6502::CPU & cpu) {
+
+	uint16_t pc = cpu.registers.PC;
+	cpu.step();
+
+	return cpu.registers.PC == pc;
+
+}
+
+int main(int argc, char ** argv) {
+
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <image> [success PC] [table|switch|cached|jit]\n", argv[0]);
+		return 2;
+	}
+
+	uint16_t successPC = argc > 2 ? (uint16_t)strtoul(argv[2], NULL, 16) : 0x3469;
+
+	Core6502::Interpreter interpreter = CORE6502_DEFAULT_INTERPRETER;
+	if (argc > 3 && !parseCore(argv[3], interpreter)) {
+		fprintf(stderr, "unknown core %s\n", argv[3]);
+		return 2;
+	}
+
+	FILE * file = fopen(argv[1], "rb");
+	if (!file) {
+		printf("SKIPPED: can't open %s\n", argv[1]);
+		return 77;
+	}
+	size_t length = fread(mem, 1, sizeof(mem), file);
+	fclose(file);
+
+	if (length <= startPC) {
+		printf("FAILED: %s is too short to be the test image\n", argv[1]);
+		return 1;
+	}
+
+	Core6502::CPU cpu(mem, interpreter);
+	cpu.reset();
+	cpu.registers.PC = startPC;
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	// Batches stop early at the success trap, anything else is caught once a batch ends
+	bool stuck = false;
+	while (!stuck && cpu.totalCycles < maxCycles) {
+		cpu.runUntil(successPC, batchCycles);
+		stuck = cpu.registers.PC == successPC || trapped(cpu);
+	}
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	double mhz = seconds > 0 ? cpu.totalCycles / seconds / 1e6 : 0;
+
+	printf("%llu cycles in %.3f s, %.1f MHz emulated\n", (unsigned long long)cpu.totalCycles, seconds, mhz);
+
+	if (cpu.registers.PC == successPC) {
+		printf("PASSED: reached success trap at $%04X\n", successPC);
+		return 0;
+	}
+
+	if (!stuck) printf("FAILED: no trap after %llu cycles, PC $%04X\n", (unsigned long long)maxCycles, cpu.registers.PC);
+	else printf("FAILED: trapped at $%04X (test number $%02X in $0200)\n", cpu.registers.PC, mem[0x0200]);
+
+	return 1;
+
+}
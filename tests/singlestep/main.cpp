@@ -0,0 +1,430 @@
+//
+//  main.cpp
+//  Core6502
+//
+//  Created by Evan Stoddard on 10/17/26.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include "Core6502.hpp"
+
+// Runs the single-step test vectors (one file per opcode, 00.json to ff.json, each an array
+// of cases giving the state before and after one instruction and the bus cycles it took)
+// against Core6502.  Worker threads each take a whole file at a time, with their own CPU and
+// 64 KiB, and stream it through a small JSON reader so no file is ever held in memory.
+//
+//  Core6502SingleStep <directory or file>... [-j threads] [-c table|switch|cached|jit] [-r reports]
+//
+// Registers, flags, the RAM listed in the final state and the number of cycles are checked.
+// The core doesn't model each cycle's bus access, so only the count of the cycles listed is
+// compared.  B and the unused bit aren't flags and are ignored in P.
+//
+// Exits 0 when every case matches, 1 on any mismatch and 77 when there are no vectors to run.
+
+// JSON pull reader over a FILE, only as much of JSON as the vectors use
+class Reader {
+
+public:
+	bool failed;
+
+	Reader(FILE * file) : file(file) {
+		length = 0;
+		position = 0;
+		failed = false;
+	}
+
+	bool begin(char open) {
+		skipSpace();
+		return expect(open);
+	}
+
+	// Moves to the next element of the array or object being read, false at its end
+	bool more(char close) {
+		skipSpace();
+		int c = peek();
+		if (c == close) {
+			position++;
+			return false;
+		}
+		if (c == ',') position++;
+		else if (c == EOF) return fail();
+		return !failed;
+	}
+
+	bool key(std::string & name) {
+		return more('}') && string(name) && begin(':');
+	}
+
+	bool string(std::string & out) {
+		out.clear();
+		if (!begin('"')) return false;
+		for (int c = get(); c != '"'; c = get()) {
+			if (c == EOF) return fail();
+			if (c == '\\') c = get();
+			out.push_back((char)c);
+		}
+		return true;
+	}
+
+	bool number(int64_t & out) {
+		skipSpace();
+		bool negative = peek() == '-';
+		if (negative) position++;
+		if (!isDigit(peek())) return fail();
+
+		out = 0;
+		while (isDigit(peek())) out = out * 10 + (get() - '0');
+		if (negative) out = -out;
+		return true;
+	}
+
+	// Skips whatever value is next
+	bool skip() {
+		skipSpace();
+		int c = peek();
+		if (c == '"') {
+			std::string ignored;
+			return string(ignored);
+		}
+		if (c == '[' || c == '{') {
+			char close = c == '[' ? ']' : '}';
+			position++;
+			std::string name;
+			while (close == '}' ? key(name) : more(close)) if (!skip()) return false;
+			return !failed;
+		}
+		if (c == EOF) return fail();
+		while (c != EOF && c != ',' && c != ']' && c != '}' && !isSpace(c)) {
+			position++;
+			c = peek();
+		}
+		return true;
+	}
+
+private:
+	FILE * file;
+	char buffer[1 << 16];
+	size_t length, position;
+
+	int peek() {
+		if (position == length) {
+			length = fread(buffer, 1, sizeof(buffer), file);
+			position = 0;
+			if (!length) return EOF;
+		}
+		return (uint8_t)buffer[position];
+	}
+
+	int get() {
+		int c = peek();
+		if (c != EOF) position++;
+		return c;
+	}
+
+	bool expect(char c) {
+		return get() == c || fail();
+	}
+
+	bool fail() {
+		failed = true;
+		return false;
+	}
+
+	static bool isSpace(int c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+	static bool isDigit(int c) { return c >= '0' && c <= '9'; }
+
+	void skipSpace() {
+		while (isSpace(peek())) position++;
+	}
+
+};
+
+struct State {
+	int64_t pc, s, a, x, y, p;
+	std::vector<std::pair<uint16_t, uint8_t> > ram;
+};
+
+struct Case {
+	std::string name;
+	State initial, final;
+	std::vector<uint16_t> cycles;       // Address of each bus cycle
+};
+
+static bool parseState(Reader & in, State & state) {
+
+	state.ram.clear();
+	if (!in.begin('{')) return false;
+
+	std::string key;
+	while (in.key(key)) {
+		if (key == "pc") in.number(state.pc);
+		else if (key == "s") in.number(state.s);
+		else if (key == "a") in.number(state.a);
+		else if (key == "x") in.number(state.x);
+		else if (key == "y") in.number(state.y);
+		else if (key == "p") in.number(state.p);
+		else if (key == "ram") {
+			in.begin('[');
+			while (in.more(']')) {
+				int64_t addr = 0, value = 0;
+				in.begin('[');
+				if (in.more(']')) in.number(addr);
+				if (in.more(']')) in.number(value);
+				while (in.more(']')) in.skip();
+				state.ram.push_back(std::make_pair((uint16_t)addr, (uint8_t)value));
+			}
+		} else in.skip();
+	}
+
+	return !in.failed;
+
+}
+
+static bool parseCase(Reader & in, Case & test) {
+
+	test.cycles.clear();
+	if (!in.begin('{')) return false;
+
+	std::string key;
+	while (in.key(key)) {
+		if (key == "name") in.string(test.name);
+		else if (key == "initial") parseState(in, test.initial);
+		else if (key == "final") parseState(in, test.final);
+		else if (key == "cycles") {
+			in.begin('[');
+			while (in.more(']')) {
+				int64_t addr = 0;
+				in.begin('[');
+				if (in.more(']')) in.number(addr);
+				while (in.more(']')) in.skip();
+				test.cycles.push_back((uint16_t)addr);
+			}
+		} else in.skip();
+	}
+
+	return !in.failed;
+
+}
+
+// Vectors use the hardware layout NV-BDIZC, the core keeps V and N in bits 5 and 6
+static uint8_t toCore(uint8_t p) {
+	return (p & 0x1F) | ((p & 0xC0) >> 1) | ((p & 0x20) << 2);
+}
+
+static uint8_t fromCore(uint8_t raw) {
+	return (raw & 0x1F) | ((raw & 0x60) << 1) | ((raw & 0x80) >> 2);
+}
+
+static const uint8_t flagMask = 0xCF;
+
+struct FileResult {
+	std::string path;
+	uint64_t cases, failed;
+	bool parsed;
+	std::vector<std::string> reports;   // First few mismatches
+};
+
+struct Options {
+	Core6502::Interpreter interpreter;
+	size_t reports;
+};
+
+static void field(std::string & out, const char * name, int64_t got, int64_t expected) {
+	if (got == expected) return;
+	char text[64];
+	snprintf(text, sizeof(text), " %s %02llx expected %02llx;", name, (long long)got, (long long)expected);
+	out += text;
+}
+
+// Runs one case, returning what differs, empty when it matches
+static std::string run(Core6502::CPU & cpu, uint8_t * mem, const Case & test) {
+
+	for (size_t i = 0; i < test.initial.ram.size(); i++) {
+		mem[test.initial.ram[i].first] = test.initial.ram[i].second;
+		cpu.bus.invalidatePage(test.initial.ram[i].first >> 8);
+	}
+
+	cpu.registers.PC = (uint16_t)test.initial.pc;
+	cpu.registers.SP = (uint8_t)test.initial.s;
+	cpu.registers.A = (uint8_t)test.initial.a;
+	cpu.registers.X = (uint8_t)test.initial.x;
+	cpu.registers.Y = (uint8_t)test.initial.y;
+	cpu.status.raw = toCore((uint8_t)test.initial.p);
+	cpu.cyclesRemaining = 0;
+
+	uint8_t cycles = cpu.step();
+
+	std::string diff;
+	field(diff, "PC", cpu.registers.PC, test.final.pc);
+	field(diff, "S", cpu.registers.SP, test.final.s);
+	field(diff, "A", cpu.registers.A, test.final.a);
+	field(diff, "X", cpu.registers.X, test.final.x);
+	field(diff, "Y", cpu.registers.Y, test.final.y);
+	field(diff, "P", fromCore(cpu.status.raw) & flagMask, test.final.p & flagMask);
+	field(diff, "cycles", cycles, test.cycles.size());
+
+	for (size_t i = 0; i < test.final.ram.size(); i++) {
+		char name[16];
+		snprintf(name, sizeof(name), "$%04x", test.final.ram[i].first);
+		field(diff, name, mem[test.final.ram[i].first], test.final.ram[i].second);
+	}
+
+	// Leave memory clean for the next case
+	for (size_t i = 0; i < test.initial.ram.size(); i++) mem[test.initial.ram[i].first] = 0;
+	for (size_t i = 0; i < test.final.ram.size(); i++) mem[test.final.ram[i].first] = 0;
+	for (size_t i = 0; i < test.cycles.size(); i++) mem[test.cycles[i]] = 0;
+
+	return diff;
+
+}
+
+static void runFile(FileResult & result, const Options & options, uint8_t * mem) {
+
+	FILE * file = fopen(result.path.c_str(), "rb");
+	if (!file) return;
+
+	memset(mem, 0, 0x10000);
+	Core6502::CPU cpu(mem, options.interpreter);
+	cpu.idleSkipping = false;
+
+	Reader in(file);
+	Case test;
+
+	if (in.begin('[')) {
+		while (in.more(']') && parseCase(in, test)) {
+			result.cases++;
+
+			std::string diff = run(cpu, mem, test);
+			if (diff.empty()) continue;
+
+			result.failed++;
+			if (result.reports.size() < options.reports) result.reports.push_back("\"" + test.name + "\":" + diff);
+		}
+	}
+
+	result.parsed = !in.failed;
+	fclose(file);
+
+}
+
+static void work(std::vector<FileResult> & results, std::atomic<size_t> & next, const Options & options) {
+
+	std::vector<uint8_t> mem(0x10000);
+
+	for (size_t i = next++; i < results.size(); i = next++)
+		runFile(results[i], options, mem.data());
+
+}
+
+static bool parseCore(const char * name, Core6502::Interpreter & interpreter) {
+
+	if (!strcmp(name, "table")) interpreter = Core6502::Interpreter::Table;
+	else if (!strcmp(name, "switch")) interpreter = Core6502::Interpreter::Switch;
+	else if (!strcmp(name, "cached")) interpreter = Core6502::Interpreter::Cached;
+#ifdef CORE6502_JIT
+	else if (!strcmp(name, "jit")) interpreter = Core6502::Interpreter::JIT;
+#endif
+	else return false;
+
+	return true;
+
+}
+
+static bool exists(const std::string & path) {
+
+	FILE * file = fopen(path.c_str(), "rb");
+	if (file) fclose(file);
+
+	return file != NULL;
+
+}
+
+int main(int argc, char ** argv) {
+
+	Options options;
+	options.interpreter = CORE6502_DEFAULT_INTERPRETER;
+	options.reports = 5;
+	unsigned threads = std::thread::hardware_concurrency();
+
+	std::vector<FileResult> results;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-j") && i + 1 < argc) threads = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-r") && i + 1 < argc) options.reports = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-c") && i + 1 < argc) {
+			if (!parseCore(argv[++i], options.interpreter)) {
+				fprintf(stderr, "unknown core %s\n", argv[i]);
+				return 2;
+			}
+		} else {
+			// A directory of xx.json files, or a single file
+			std::vector<std::string> paths;
+			for (int opCode = 0; opCode < 0x100; opCode++) {
+				char name[16];
+				snprintf(name, sizeof(name), "/%02x.json", opCode);
+				if (exists(argv[i] + std::string(name))) paths.push_back(argv[i] + std::string(name));
+			}
+			if (paths.empty() && exists(argv[i])) paths.push_back(argv[i]);
+
+			for (size_t j = 0; j < paths.size(); j++) {
+				FileResult result;
+				result.path = paths[j];
+				result.cases = 0;
+				result.failed = 0;
+				result.parsed = false;
+				results.push_back(result);
+			}
+		}
+	}
+
+	if (results.empty()) {
+		printf("SKIPPED: no test vectors found\n");
+		return 77;
+	}
+
+	if (threads == 0) threads = 1;
+	if (threads > results.size()) threads = (unsigned)results.size();
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	std::atomic<size_t> next(0);
+	std::vector<std::thread> pool;
+	for (unsigned i = 1; i < threads; i++) pool.push_back(std::thread(work, std::ref(results), std::ref(next), std::cref(options)));
+	work(results, next, options);
+	for (size_t i = 0; i < pool.size(); i++) pool[i].join();
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	uint64_t cases = 0, failed = 0;
+	size_t failedFiles = 0;
+	bool parsed = true;
+
+	for (size_t i = 0; i < results.size(); i++) {
+		const FileResult & result = results[i];
+		cases += result.cases;
+		failed += result.failed;
+		parsed &= result.parsed;
+
+		if (!result.parsed) printf("%s: parse error after %llu cases\n", result.path.c_str(), (unsigned long long)result.cases);
+		if (!result.failed) continue;
+
+		failedFiles++;
+		printf("%s: %llu of %llu failed\n", result.path.c_str(), (unsigned long long)result.failed, (unsigned long long)result.cases);
+		for (size_t j = 0; j < result.reports.size(); j++) printf("    %s\n", result.reports[j].c_str());
+	}
+
+	printf("%llu cases from %zu files on %u threads in %.2f s (%.0f cases/s), %llu failed in %zu files\n",
+		(unsigned long long)cases, results.size(), threads, seconds, seconds > 0 ? cases / seconds : 0,
+		(unsigned long long)failed, failedFiles);
+
+	return failed || !parsed ? 1 : 0;
+
+}